@@ -0,0 +1,343 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "fcfs.h"
+#include "taskset.h"
+#include "sjf.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @Benchmark
+/// Runs each First Come First Served engine, and Shortest Job First for comparison, over task
+/// counts from 10 up to the given maximum and several burst distributions. Every run prints one
+/// CSV row to stdout:
+///
+///     engine,distribution,tasks,quantum,runs,seconds,tasks_per_sec,slices_per_sec,ns_per_queue_op,peak_rss_kb,average_wait
+///
+/// seconds is the mean over all runs; ns_per_queue_op is 0 for engines which don't use the queue
+/// and peak_rss_kb is the peak resident set of the whole process so far. average_wait is the
+/// average wait time of the schedule, the smallest possible one for sjf.
+///
+/// fcfs_scalar is a plain loop over the task array for fcfs_fast to be measured against; once there
+/// are FAST_CHECK_TASKS tasks, fcfs_fast running more than FAST_TOLERANCE times slower than it is
+/// reported on stderr.
+///
+/// @Usage
+/// ./fcfsbench [max_tasks]
+//----------------------------------------------------------------------------------------------------------------------------------
+
+
+#define DEFAULT_MAX_TASKS 10000000
+
+// Small task counts are repeated until they have run for at least this long
+#define MIN_BENCH_SECONDS 0.02
+
+// Smallest task count at which fcfs_fast is checked against fcfs_scalar, and how much slower it may be
+#define FAST_CHECK_TASKS 1000000
+#define FAST_TOLERANCE 1.2
+
+
+///-------------------------------------------------
+/// @brief  Burst length distributions to draw
+///         execution times from
+///-------------------------------------------------
+enum distribution_t {
+    UNIFORM,
+    CONSTANT,
+    EXPONENTIAL,
+    BIMODAL,
+    DISTRIBUTION_COUNT
+};
+
+
+///-------------------------------------------------
+/// @brief  Engines under test
+///-------------------------------------------------
+enum engine_t {
+    ENGINE_QUEUE,
+    ENGINE_FAST,
+    ENGINE_SCALAR,
+    ENGINE_TASK_SET,
+    ENGINE_SJF,
+    ENGINE_COUNT
+};
+
+
+static const char* distributionNames[DISTRIBUTION_COUNT] = {"uniform", "constant", "exponential", "bimodal"};
+static const char* engineNames[ENGINE_COUNT] = {"fcfs_queue", "fcfs_fast", "fcfs_scalar", "fcfs_task_set", "sjf"};
+
+
+static unsigned int nextRandom(unsigned int* seed);
+static void fillBursts(int* execution, int size, enum distribution_t distribution);
+static double now(void);
+static long peakRssKb(void);
+static void scalarPrefixSum(struct task_t* task, int size);
+static double runEngine(enum engine_t engine, struct task_t* task, struct task_set_t* set, int* execution, int size);
+static double averageWait(enum engine_t engine, struct task_t* task, struct task_set_t* set, int size);
+
+
+int main(int argc, const char* argv[])
+{
+    int maxTasks = DEFAULT_MAX_TASKS;
+
+    if(argc > 1)
+    {
+        maxTasks = atoi(argv[1]);
+    }
+
+    if(maxTasks < 10)
+    {
+        fprintf(stderr, "usage: %s [max_tasks >= 10]\n", argv[0]);
+        return 1;
+    }
+
+    int* execution = (int*)malloc((size_t)maxTasks * sizeof(int));
+    struct task_t* task = (struct task_t*)malloc((size_t)maxTasks * sizeof(struct task_t));
+    struct task_set_t set;
+
+    if((execution == NULL) || (task == NULL) || task_set_create(&set, maxTasks))
+    {
+        fprintf(stderr, "%s: Couldn't allocate %d tasks!\n", argv[0], maxTasks);
+        return 1;
+    }
+
+    printf("engine,distribution,tasks,quantum,runs,seconds,tasks_per_sec,slices_per_sec,ns_per_queue_op,peak_rss_kb,average_wait\n");
+
+    for(int distribution = 0; distribution < DISTRIBUTION_COUNT; distribution++)
+    {
+        for(long long size = 10; size <= maxTasks; size *= 10)
+        {
+            fillBursts(execution, (int)size, (enum distribution_t)distribution);
+
+            double engineSeconds[ENGINE_COUNT];
+
+            for(int engine = 0; engine < ENGINE_COUNT; engine++)
+            {
+                int runs = 0;
+                double elapsed = 0;
+
+                // Repeat short runs so the timer resolution
+                // doesn't dominate
+                do
+                {
+                    elapsed += runEngine((enum engine_t)engine, task, &set, execution, (int)size);
+                    runs++;
+                } while(elapsed < MIN_BENCH_SECONDS);
+
+                double seconds = elapsed / runs;
+
+                engineSeconds[engine] = seconds;
+
+                // NOTE: The queue engine pushes, peeks and pops
+                //       every task once
+                double queueOps = (engine == ENGINE_QUEUE) ? (3.0 * size) : 0;
+
+                printf("%s,%s,%lld,0,%d,%.9f,%.0f,%.0f,%.2f,%ld,%.3f\n",
+                       engineNames[engine], distributionNames[distribution], size, runs, seconds,
+                       size / seconds, size / seconds, (queueOps > 0) ? (seconds * 1e9 / queueOps) : 0,
+                       peakRssKb(), averageWait((enum engine_t)engine, task, &set, (int)size));
+                fflush(stdout);
+            }
+
+            if((size >= FAST_CHECK_TASKS) && (engineSeconds[ENGINE_FAST] > (FAST_TOLERANCE * engineSeconds[ENGINE_SCALAR])))
+            {
+                fprintf(stderr, "%s: fcfs_fast took %.2fx as long as fcfs_scalar on %lld %s tasks!\n", argv[0],
+                        engineSeconds[ENGINE_FAST] / engineSeconds[ENGINE_SCALAR], size, distributionNames[distribution]);
+            }
+        }
+    }
+
+    task_set_free(&set);
+    free(task);
+    free(execution);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Run one engine over freshly initialized
+///         tasks
+///
+/// @param[in] engine Engine to run
+/// @param[in] task Task array to schedule
+/// @param[in] set Task set to schedule
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+///
+/// @return Seconds spent scheduling
+///-------------------------------------------------
+static double runEngine(enum engine_t engine, struct task_t* task, struct task_set_t* set, int* execution, int size)
+{
+    double start;
+
+    if(engine == ENGINE_TASK_SET)
+    {
+        set->size = size;
+        task_set_init(set, execution);
+
+        start = now();
+        task_set_first_come_first_served(set);
+
+        return now() - start;
+    }
+
+    init(task, execution, size);
+    start = now();
+
+    if(engine == ENGINE_FAST)
+    {
+        first_come_first_served_fast(task, size);
+    }
+    else if(engine == ENGINE_SCALAR)
+    {
+        scalarPrefixSum(task, size);
+    }
+    else if(engine == ENGINE_SJF)
+    {
+        shortest_job_first(task, size, NULL);
+    }
+    else
+    {
+        first_come_first_served_traced(task, size, NULL);
+    }
+
+    return now() - start;
+}
+
+
+///-------------------------------------------------
+/// @brief  Reference for fcfs_fast: the prefix sum
+///         as the plainest loop
+///
+/// @param[in] task Task array to schedule
+/// @param[in] size Number of tasks
+///-------------------------------------------------
+static void scalarPrefixSum(struct task_t* task, int size)
+{
+    int runTime = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        task[i].waiting_time = runTime;
+        runTime += task[i].execution_time;
+        task[i].turnaround_time = runTime;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Average wait time of the last run of an
+///         engine, summed without rounding
+///
+/// @param[in] engine Engine which ran
+/// @param[in] task Task array it scheduled
+/// @param[in] set Task set it scheduled
+/// @param[in] size Number of tasks
+///
+/// @return Average wait time
+///-------------------------------------------------
+static double averageWait(enum engine_t engine, struct task_t* task, struct task_set_t* set, int size)
+{
+    long long totalWait = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        totalWait += (engine == ENGINE_TASK_SET) ? set->waiting_time[i] : task[i].waiting_time;
+    }
+
+    return (double)totalWait / size;
+}
+
+
+///-------------------------------------------------
+/// @brief  Fill the execution times from a burst
+///         distribution with a fixed seed
+///
+/// @param[out] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] distribution Distribution to use
+///-------------------------------------------------
+static void fillBursts(int* execution, int size, enum distribution_t distribution)
+{
+    unsigned int seed = 2024;
+
+    for(int i = 0; i < size; i++)
+    {
+        unsigned int draw = nextRandom(&seed);
+
+        switch(distribution)
+        {
+            case UNIFORM:
+                execution[i] = 1 + (int)(draw % 100);
+                break;
+
+            case CONSTANT:
+                execution[i] = 50;
+                break;
+
+            case EXPONENTIAL:
+                // Mean of about 50 by inverse transform
+                // sampling; draw is 24 bits wide
+                execution[i] = 1 + (int)(-49.5 * log((draw + 1.0) / 16777216.0));
+                break;
+
+            case BIMODAL:
+                // Mostly short interactive bursts with a few
+                // long batch jobs
+                execution[i] = ((draw % 10) == 0) ? (500 + (int)(nextRandom(&seed) % 501)) : (1 + (int)(nextRandom(&seed) % 10));
+                break;
+
+            default:
+                execution[i] = 1;
+                break;
+        }
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Linear congruential generator, so every
+///         run sees the same workload
+///
+/// @param[in] seed Generator state
+///
+/// @return The next pseudo-random value
+///-------------------------------------------------
+static unsigned int nextRandom(unsigned int* seed)
+{
+    *seed = (*seed * 1103515245u) + 12345u;
+
+    return (*seed >> 8);
+}
+
+
+///-------------------------------------------------
+/// @brief  Read the monotonic clock
+///
+/// @return Seconds since an arbitrary point
+///-------------------------------------------------
+static double now(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + (time.tv_nsec * 1e-9);
+}
+
+
+///-------------------------------------------------
+/// @brief  Peak resident set size of the process
+///
+/// @return Peak RSS in kilobytes
+///-------------------------------------------------
+static long peakRssKb(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
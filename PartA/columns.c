@@ -0,0 +1,313 @@
+#include "columns.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+static const char columnMagic[8] = {'S', 'C', 'H', 'E', 'D', 'C', 'O', 'L'};
+
+
+static int mapFile(struct column_file_t* file, int fd, size_t length, int writable);
+static int isValidLayout(const struct column_file_t* file);
+static size_t alignUp(size_t offset);
+
+
+///-------------------------------------------------
+/// @brief  Map a column file read-only and check
+///         its header
+///
+/// @param[out] file The column file
+/// @param[in] path Path of the file
+///
+/// @return 1: Invalid file; 0: Success
+///-------------------------------------------------
+int column_file_open(struct column_file_t* file, const char* path)
+{
+    struct stat info;
+    int fd = open(path, O_RDONLY);
+
+    file->base = NULL;
+
+    if((fd < 0) || (fstat(fd, &info) != 0))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't open %s!\n", __func__, path);
+
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+
+        return 1;
+    }
+
+    if(((size_t)info.st_size < sizeof(struct column_header_t)) || mapFile(file, fd, (size_t)info.st_size, 0))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't map %s!\n", __func__, path);
+        close(fd);
+        return 1;
+    }
+
+    if(!isValidLayout(file))
+    {
+        fprintf(stderr, "%s() ERROR: %s isn't a version %d column file!\n", __func__, path, COLUMN_FILE_VERSION);
+        column_file_close(file);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Lay out, size and map a new column file
+///
+/// @param[out] file The column file
+/// @param[in] path Path of the file
+/// @param[in] rows Entries in every column
+/// @param[in] columns Id and width of each column
+/// @param[in] count Number of columns
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int column_file_create(struct column_file_t* file, const char* path, long long rows, const struct column_desc_t* columns, int count)
+{
+    file->base = NULL;
+
+    if((rows < 0) || (count < 1) || (count > COLUMN_FILE_MAX_COLUMNS))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid layout!\n", __func__);
+        return 1;
+    }
+
+    // The columns follow the header and descriptors,
+    // each on its own aligned offset
+    size_t length = sizeof(struct column_header_t) + (count * sizeof(struct column_desc_t));
+    uint64_t offset[COLUMN_FILE_MAX_COLUMNS];
+
+    for(int i = 0; i < count; i++)
+    {
+        if((columns[i].width != 4) && (columns[i].width != 8))
+        {
+            fprintf(stderr, "%s() ERROR: Invalid column width %u!\n", __func__, columns[i].width);
+            return 1;
+        }
+
+        offset[i] = alignUp(length);
+        length = offset[i] + ((size_t)rows * columns[i].width);
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if((fd < 0) || (ftruncate(fd, (off_t)length) != 0) || mapFile(file, fd, length, 1))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create %s!\n", __func__, path);
+
+        if(fd >= 0)
+        {
+            close(fd);
+        }
+
+        return 1;
+    }
+
+    // NOTE: ftruncate() zero fills the file, so only
+    //       the header needs writing
+    struct column_header_t* header = (struct column_header_t*)file->base;
+
+    memcpy(header->magic, columnMagic, sizeof(columnMagic));
+    header->version = COLUMN_FILE_VERSION;
+    header->column_count = (uint32_t)count;
+    header->rows = rows;
+    file->rows = rows;
+    file->column_count = count;
+
+    for(int i = 0; i < count; i++)
+    {
+        file->columns[i].id = columns[i].id;
+        file->columns[i].width = columns[i].width;
+        file->columns[i].offset = offset[i];
+    }
+
+    if(!isValidLayout(file))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid layout!\n", __func__);
+        column_file_close(file);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Find a column by id
+///
+/// @param[in] file The column file
+/// @param[in] id The column to find
+/// @param[out] width Bytes per entry, or NULL
+///
+/// @return The column; NULL: Not in the file
+///-------------------------------------------------
+void* column_file_column(const struct column_file_t* file, enum column_id_t id, int* width)
+{
+    for(int i = 0; i < file->column_count; i++)
+    {
+        if(file->columns[i].id == (uint32_t)id)
+        {
+            if(width != NULL)
+            {
+                *width = (int)file->columns[i].width;
+            }
+
+            return file->base + file->columns[i].offset;
+        }
+    }
+
+    return NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Flush a read-write mapping to disk
+///
+/// @param[in] file The column file
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int column_file_sync(struct column_file_t* file)
+{
+    if(!file->writable || (msync(file->base, file->length, MS_SYNC) != 0))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't sync column file!\n", __func__);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Unmap and close a column file
+///
+/// @param[in] file The column file
+///-------------------------------------------------
+void column_file_close(struct column_file_t* file)
+{
+    if(file->base == NULL)
+    {
+        return;
+    }
+
+    munmap(file->base, file->length);
+    close(file->fd);
+
+    file->base = NULL;
+    file->columns = NULL;
+    file->column_count = 0;
+    file->rows = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Map an open file and point the file
+///         structure at its header
+///
+/// @param[out] file The column file
+/// @param[in] fd Descriptor of the open file
+/// @param[in] length Length of the file
+/// @param[in] writable Map it read-write
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+static int mapFile(struct column_file_t* file, int fd, size_t length, int writable)
+{
+    void* base = mmap(NULL, length, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+
+    if(base == MAP_FAILED)
+    {
+        return 1;
+    }
+
+    struct column_header_t* header = (struct column_header_t*)base;
+
+    file->fd = fd;
+    file->writable = writable;
+    file->base = (unsigned char*)base;
+    file->length = length;
+    file->columns = (struct column_desc_t*)(file->base + sizeof(struct column_header_t));
+
+    // NOTE: A new file has no header yet, so its
+    //       creator fills these in
+    file->rows = writable ? 0 : header->rows;
+    file->column_count = writable ? 0 : (int)header->column_count;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check that the header is current and
+///         every column is aligned, unique and
+///         inside the file
+///
+/// @param[in] file The column file
+///
+/// @return True/False
+///-------------------------------------------------
+static int isValidLayout(const struct column_file_t* file)
+{
+    const struct column_header_t* header = (const struct column_header_t*)file->base;
+
+    if((memcmp(header->magic, columnMagic, sizeof(columnMagic)) != 0) || (header->version != COLUMN_FILE_VERSION) ||
+       (header->column_count < 1) || (header->column_count > COLUMN_FILE_MAX_COLUMNS) || (header->rows < 0))
+    {
+        return 0;
+    }
+
+    size_t descriptorEnd = sizeof(struct column_header_t) + (header->column_count * sizeof(struct column_desc_t));
+
+    if(descriptorEnd > file->length)
+    {
+        return 0;
+    }
+
+    const struct column_desc_t* columns = (const struct column_desc_t*)(file->base + sizeof(struct column_header_t));
+
+    for(uint32_t i = 0; i < header->column_count; i++)
+    {
+        uint64_t width = columns[i].width;
+
+        if(((width != 4) && (width != 8)) || (columns[i].offset < descriptorEnd) ||
+           ((columns[i].offset % COLUMN_ALIGNMENT) != 0) || (columns[i].offset > file->length) ||
+           ((uint64_t)header->rows > (file->length - columns[i].offset) / width))
+        {
+            return 0;
+        }
+
+        for(uint32_t j = 0; j < i; j++)
+        {
+            if(columns[j].id == columns[i].id)
+            {
+                return 0;
+            }
+        }
+    }
+
+    return 1;
+}
+
+
+///-------------------------------------------------
+/// @brief  Round an offset up to the column
+///         alignment
+///
+/// @param[in] offset The offset
+///
+/// @return The aligned offset
+///-------------------------------------------------
+static size_t alignUp(size_t offset)
+{
+    return (offset + COLUMN_ALIGNMENT - 1) & ~((size_t)COLUMN_ALIGNMENT - 1);
+}
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#ifndef __COLUMNS__
+#define __COLUMNS__
+
+// Version written by column_file_create() and the only one column_file_open() accepts
+#define COLUMN_FILE_VERSION 1
+
+// Most columns a file may hold
+#define COLUMN_FILE_MAX_COLUMNS 16
+
+// Every column starts on a multiple of this many bytes
+#define COLUMN_ALIGNMENT 64
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Columns a column file can hold, each at most once
+//----------------------------------------------------------------------------------------------------------------------------------
+enum column_id_t {
+    COLUMN_PROCESS_ID,
+    COLUMN_EXECUTION_TIME,
+    COLUMN_ARRIVAL_TIME,
+    COLUMN_PRIORITY,
+    COLUMN_WAITING_TIME,
+    COLUMN_TURNAROUND_TIME
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Header at the start of a column file, in host byte order
+///
+/// @note The header is followed by column_count column_desc_t entries, then the columns themselves
+//----------------------------------------------------------------------------------------------------------------------------------
+struct column_header_t {
+
+    // Always "SCHEDCOL"
+    char magic[8];
+
+    // Layout version of the file
+    uint32_t version;
+
+    // Number of columns in the file
+    uint32_t column_count;
+
+    // Number of entries in every column
+    int64_t rows;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Description of one column of a column file
+//----------------------------------------------------------------------------------------------------------------------------------
+struct column_desc_t {
+
+    // Which column this is (enum column_id_t)
+    uint32_t id;
+
+    // Bytes per entry: 4 for int32_t, 8 for int64_t
+    uint32_t width;
+
+    // Offset of the first entry from the start of the file
+    uint64_t offset;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which maps a column file into memory
+//----------------------------------------------------------------------------------------------------------------------------------
+struct column_file_t {
+
+    // Descriptor of the open file
+    int fd;
+
+    // Whether the columns may be written
+    int writable;
+
+    // Start of the mapping
+    unsigned char* base;
+
+    // Length of the mapping in bytes
+    size_t length;
+
+    // Number of entries in every column
+    long long rows;
+
+    // Number of columns in the file
+    int column_count;
+
+    // Description of each column, inside the mapping
+    struct column_desc_t* columns;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Map an existing column file read-only
+///
+/// @param[out] file The column file
+/// @param[in] path Path of the file
+///
+/// @return 0 on success, 1 if the file couldn't be mapped or isn't a valid column file
+//----------------------------------------------------------------------------------------------------------------------------------
+int column_file_open(struct column_file_t *file, const char *path);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create a column file of zeroed columns and map it read-write, so the columns can be
+/// filled in place
+///
+/// @param[out] file The column file
+/// @param[in] path Path of the file, which is replaced if it exists
+/// @param[in] rows The number of entries in every column
+/// @param[in] columns The id and width of each column; the offsets are ignored
+/// @param[in] count The number of columns
+///
+/// @return 0 on success, 1 if the layout is invalid or the file couldn't be created
+//----------------------------------------------------------------------------------------------------------------------------------
+int column_file_create(struct column_file_t *file, const char *path, long long rows, const struct column_desc_t *columns, int count);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Find a column of the file
+///
+/// @param[in] file The column file
+/// @param[in] id The column to find
+/// @param[out] width Bytes per entry of the column, may be NULL
+///
+/// @return The first entry of the column, NULL if the file doesn't hold it
+//----------------------------------------------------------------------------------------------------------------------------------
+void *column_file_column(const struct column_file_t *file, enum column_id_t id, int *width);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Write the columns of a read-write file back to disk
+///
+/// @param[in] file The column file
+///
+/// @return 0 on success, 1 on failure
+//----------------------------------------------------------------------------------------------------------------------------------
+int column_file_sync(struct column_file_t *file);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Unmap and close the file; columns borrowed from it are no longer valid
+///
+/// @param[in] file The column file
+//----------------------------------------------------------------------------------------------------------------------------------
+void column_file_close(struct column_file_t *file);
+
+#endif // __COLUMNS__
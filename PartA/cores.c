@@ -0,0 +1,268 @@
+#include "cores.h"
+#include <limits.h>
+
+
+///-------------------------------------------------
+/// @brief  Configure a global queue
+///
+/// @param[in] cores Number of cores
+///
+/// @return The configuration
+///-------------------------------------------------
+struct multicore_config_t multicore_default_config(int cores)
+{
+    struct multicore_config_t config;
+
+    config.cores = cores;
+    config.mode = MULTICORE_GLOBAL;
+    config.fit = FIT_FIRST;
+    config.capacity = 0;
+
+    return config;
+}
+
+
+///-------------------------------------------------
+/// @brief  Create a core tree of zero keys
+///
+/// @param[out] tree The core tree
+/// @param[in] cores Number of cores
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int core_tree_init(struct core_tree_t* tree, int cores)
+{
+    int leaves = 1;
+
+    while(leaves < cores)
+    {
+        leaves *= 2;
+    }
+
+    tree->cores = cores;
+    tree->leaves = leaves;
+    tree->key = (long long*)malloc(2 * (size_t)leaves * sizeof(long long));
+
+    if(tree->key == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create core tree!\n", __func__);
+        return 1;
+    }
+
+    // NOTE: Leaves past the last core never win
+    for(int i = 0; i < leaves; i++)
+    {
+        tree->key[leaves + i] = (i < cores) ? 0 : LLONG_MAX;
+    }
+
+    for(int node = leaves - 1; node > 0; node--)
+    {
+        long long left = tree->key[2 * node];
+        long long right = tree->key[(2 * node) + 1];
+
+        tree->key[node] = (left <= right) ? left : right;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Set the key of a core and update the
+///         nodes above it
+///
+/// @param[in] tree The core tree
+/// @param[in] core The core
+/// @param[in] key The new key
+///-------------------------------------------------
+void core_tree_set(struct core_tree_t* tree, int core, long long key)
+{
+    int node = tree->leaves + core;
+
+    tree->key[node] = key;
+
+    for(node /= 2; node > 0; node /= 2)
+    {
+        long long left = tree->key[2 * node];
+        long long right = tree->key[(2 * node) + 1];
+
+        tree->key[node] = (left <= right) ? left : right;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the key of a core
+///
+/// @param[in] tree The core tree
+/// @param[in] core The core
+///
+/// @return The key
+///-------------------------------------------------
+long long core_tree_key(struct core_tree_t* tree, int core)
+{
+    return tree->key[tree->leaves + core];
+}
+
+
+///-------------------------------------------------
+/// @brief  Walk down to the leftmost smallest key
+///
+/// @param[in] tree The core tree
+///
+/// @return The core
+///-------------------------------------------------
+int core_tree_min(struct core_tree_t* tree)
+{
+    int node = 1;
+
+    while(node < tree->leaves)
+    {
+        node *= 2;
+
+        // Go right only if the left half is larger
+        if(tree->key[node] > tree->key[node + 1])
+        {
+            node++;
+        }
+    }
+
+    return node - tree->leaves;
+}
+
+
+///-------------------------------------------------
+/// @brief  Walk down to the leftmost key at most a
+///         limit
+///
+/// @param[in] tree The core tree
+/// @param[in] limit The largest key accepted
+///
+/// @return The core; -1: None
+///-------------------------------------------------
+int core_tree_first_at_most(struct core_tree_t* tree, long long limit)
+{
+    int node = 1;
+
+    if(tree->key[1] > limit)
+    {
+        return -1;
+    }
+
+    while(node < tree->leaves)
+    {
+        node *= 2;
+
+        // The left half holds a match unless its
+        // smallest key is over the limit
+        if(tree->key[node] > limit)
+        {
+            node++;
+        }
+    }
+
+    return node - tree->leaves;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the keys of a core tree
+///
+/// @param[in] tree The core tree
+///-------------------------------------------------
+void core_tree_free(struct core_tree_t* tree)
+{
+    free(tree->key);
+
+    tree->key = NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Assign each task to a core
+///
+/// @param[in] task The task array
+/// @param[in] size Number of tasks
+/// @param[in] config The processors
+/// @param[out] core Core of each task
+/// @param[out] stats Tasks and work of each core
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int cores_partition(struct task_t* task, int size, const struct multicore_config_t* config, int* core,
+                    struct core_stats_t* stats)
+{
+    struct core_tree_t tree;
+    long long capacity = config->capacity;
+
+    if(core_tree_init(&tree, config->cores))
+    {
+        return 1;
+    }
+
+    for(int i = 0; i < config->cores; i++)
+    {
+        stats[i].busy_time = 0;
+        stats[i].tasks = 0;
+        stats[i].utilization = 0;
+    }
+
+    if(capacity <= 0)
+    {
+        long long totalWork = 0;
+
+        for(int i = 0; i < size; i++)
+        {
+            totalWork += task[i].execution_time;
+        }
+
+        capacity = (totalWork + config->cores - 1) / config->cores;
+    }
+
+    // The tree holds the work of each core, or its
+    // number of tasks for FIT_LEAST_LOADED
+    for(int i = 0; i < size; i++)
+    {
+        int chosen = -1;
+
+        if(config->fit == FIT_FIRST)
+        {
+            chosen = core_tree_first_at_most(&tree, capacity - task[i].execution_time);
+        }
+
+        // NOTE: The least work is also the most spare
+        //       capacity, and where a task which fits
+        //       nowhere overflows to
+        if(chosen < 0)
+        {
+            chosen = core_tree_min(&tree);
+        }
+
+        core[i] = chosen;
+        stats[chosen].tasks++;
+        stats[chosen].busy_time += task[i].execution_time;
+
+        core_tree_set(&tree, chosen, (config->fit == FIT_LEAST_LOADED) ? stats[chosen].tasks : stats[chosen].busy_time);
+    }
+
+    core_tree_free(&tree);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Divide each core's busy time by the
+///         makespan
+///
+/// @param[in] stats Statistics of each core
+/// @param[in] cores Number of cores
+/// @param[in] makespan Time the last task finished
+///-------------------------------------------------
+void cores_utilization(struct core_stats_t* stats, int cores, long long makespan)
+{
+    for(int i = 0; i < cores; i++)
+    {
+        stats[i].utilization = (makespan > 0) ? ((float)stats[i].busy_time / makespan) : 0;
+    }
+}
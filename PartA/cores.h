@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "fcfs.h"
+
+#ifndef __CORES__
+#define __CORES__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief How the tasks are shared between the cores
+//----------------------------------------------------------------------------------------------------------------------------------
+enum multicore_mode_t {
+    // One ready queue which every core takes its next task from
+    MULTICORE_GLOBAL,
+
+    // Every task is assigned to a core up front and only ever runs on it
+    MULTICORE_PARTITIONED
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Heuristics which assign the tasks to cores, in task order, for MULTICORE_PARTITIONED
+//----------------------------------------------------------------------------------------------------------------------------------
+enum core_fit_t {
+    // Lowest numbered core whose work stays within the capacity, else the core with the least work
+    FIT_FIRST,
+
+    // Core with the most capacity to spare, i.e. the least work
+    FIT_WORST,
+
+    // Core with the fewest tasks, whatever their length
+    FIT_LEAST_LOADED
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which describes the processors to schedule on
+//----------------------------------------------------------------------------------------------------------------------------------
+struct multicore_config_t {
+
+    // Number of cores
+    int cores;
+
+    // Global or partitioned ready queues
+    enum multicore_mode_t mode;
+
+    // Assignment heuristic (MULTICORE_PARTITIONED)
+    enum core_fit_t fit;
+
+    // Work each core may be given (FIT_FIRST), 0 for the total work spread evenly over the cores
+    long long capacity;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds what one core did during a run
+//----------------------------------------------------------------------------------------------------------------------------------
+struct core_stats_t {
+
+    // Time the core spent executing tasks
+    long long busy_time;
+
+    // Number of tasks which finished on the core
+    int tasks;
+
+    // Busy time as a fraction of the time until the last task finished on any core
+    float utilization;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Min-tree of one key per core, which finds the core to use next in O(log cores)
+//----------------------------------------------------------------------------------------------------------------------------------
+struct core_tree_t {
+
+    // Number of cores
+    int cores;
+
+    // Number of leaves, the next power of two
+    int leaves;
+
+    // Heap ordered nodes; node i covers nodes 2i and 2i + 1 and holds the smaller of their keys,
+    // and leaf (leaves + core) holds the key of a core
+    long long* key;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Configure a single global queue over the given number of cores
+///
+/// @param[in] cores The number of cores
+///
+/// @return The configuration
+//----------------------------------------------------------------------------------------------------------------------------------
+struct multicore_config_t multicore_default_config(int cores);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create a core tree with every key set to 0
+///
+/// @param[out] tree The core tree
+/// @param[in] cores The number of cores
+///
+/// @return 0 on success, 1 if the tree couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int core_tree_init(struct core_tree_t *tree, int cores);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Set the key of a core
+///
+/// @param[in] tree The core tree
+/// @param[in] core The core
+/// @param[in] key The new key
+//----------------------------------------------------------------------------------------------------------------------------------
+void core_tree_set(struct core_tree_t *tree, int core, long long key);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the key of a core
+///
+/// @param[in] tree The core tree
+/// @param[in] core The core
+///
+/// @return The key
+//----------------------------------------------------------------------------------------------------------------------------------
+long long core_tree_key(struct core_tree_t *tree, int core);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Find the lowest numbered core with the smallest key
+///
+/// @param[in] tree The core tree
+///
+/// @return The core
+//----------------------------------------------------------------------------------------------------------------------------------
+int core_tree_min(struct core_tree_t *tree);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Find the lowest numbered core whose key is at most a limit
+///
+/// @param[in] tree The core tree
+/// @param[in] limit The largest key accepted
+///
+/// @return The core, -1 if every key is above the limit
+//----------------------------------------------------------------------------------------------------------------------------------
+int core_tree_first_at_most(struct core_tree_t *tree, long long limit);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the memory held by a core tree
+///
+/// @param[in] tree The core tree
+//----------------------------------------------------------------------------------------------------------------------------------
+void core_tree_free(struct core_tree_t *tree);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Assign every task to a core with the configured heuristic, in task order
+///
+/// @param[in] task The task information
+/// @param[in] size The size of the task array
+/// @param[in] config The processors
+/// @param[out] core The buffer receiving the core of each task
+/// @param[out] stats The buffer receiving the number of tasks and the work given to each core,
+///                   one entry per core
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int cores_partition(struct task_t *task, int size, const struct multicore_config_t *config, int *core,
+                    struct core_stats_t *stats);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Fill in the utilization of each core from its busy time
+///
+/// @param[in] stats The statistics of each core
+/// @param[in] cores The number of cores
+/// @param[in] makespan Time at which the last task finished
+//----------------------------------------------------------------------------------------------------------------------------------
+void cores_utilization(struct core_stats_t *stats, int cores, long long makespan);
+
+#endif // __CORES__
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef __EVENTS__
+#define __EVENTS__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds one event of a discrete-event simulation
+//----------------------------------------------------------------------------------------------------------------------------------
+struct event_t {
+
+    // Time at which the event happens
+    long long time;
+
+    // Order in which the event was pushed, which breaks ties between events at the same time
+    long long sequence;
+
+    // What happens, defined by the simulation
+    int kind;
+
+    // Task the event is about
+    int index;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Min-heap of events ordered by time, then by the order they were pushed in
+//----------------------------------------------------------------------------------------------------------------------------------
+struct event_queue_t {
+
+    // Binary heap; the children of entry i are entries 2i + 1 and 2i + 2
+    struct event_t* heap;
+
+    // Number of events in the heap
+    int size;
+
+    // Number of events the heap can hold before it has to grow
+    int capacity;
+
+    // Number of events pushed so far
+    long long pushed;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty event queue
+///
+/// @param[out] queue The event queue
+/// @param[in] capacity The number of events the queue holds before it has to grow
+///
+/// @return 0 on success, 1 if the heap couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int event_queue_init(struct event_queue_t *queue, int capacity);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Schedule an event, doubling the capacity if the queue is full
+///
+/// @param[in] queue The event queue
+/// @param[in] time The time at which the event happens
+/// @param[in] kind What happens
+/// @param[in] index The task the event is about
+///
+/// @return 0 on success, 1 if the queue couldn't grow
+//----------------------------------------------------------------------------------------------------------------------------------
+int event_push(struct event_queue_t *queue, long long time, int kind, int index);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the earliest event without removing it
+///
+/// @param[in] queue The event queue
+///
+/// @return the earliest event, NULL if the queue is empty
+//----------------------------------------------------------------------------------------------------------------------------------
+const struct event_t* event_peek(struct event_queue_t *queue);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Remove the earliest event from the queue
+///
+/// @param[in] queue The event queue, which must not be empty
+/// @param[out] event The earliest event
+//----------------------------------------------------------------------------------------------------------------------------------
+void event_pop(struct event_queue_t *queue, struct event_t *event);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Check if the event queue is empty
+///
+/// @param[in] queue The event queue
+///
+/// @return True/False
+//----------------------------------------------------------------------------------------------------------------------------------
+int event_queue_is_empty(struct event_queue_t *queue);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the memory held by the event queue
+///
+/// @param[in] queue The event queue
+//----------------------------------------------------------------------------------------------------------------------------------
+void event_queue_free(struct event_queue_t *queue);
+
+#endif // __EVENTS__
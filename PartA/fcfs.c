@@ -1,9 +1,27 @@
 #include "fcfs.h"
 #include "queue.h"
+#include "workload.h"
+#include "events.h"
+#include "intake.h"
 #include <limits.h>
+#include <sched.h>
 #include <stdio.h>
 
 
+// Tasks read from a workload file at a time
+#define STREAM_CHUNK 4096
+
+
+// Kinds of event of the event-driven scheduler
+#define EVENT_ARRIVAL 0
+#define EVENT_COMPLETION 1
+
+
+static void prefixSum(struct task_t* task, int size, int* runTime);
+static int queueTask(struct node_t** queue, struct task_t* task);
+static int drainIntake(struct intake_queue_t* intake, struct node_t** queue, long long now, int limit);
+
+
 ///-------------------------------------------------
 /// @brief  Initializes the First Come First Served
 ///         unit tests
@@ -23,6 +41,7 @@ void init(struct task_t* task, int* execution, int size)
     {
         task[i].process_id  = i;
         task[i].execution_time = execution[i];
+        task[i].arrival_time = 0;
     }
 }
 
@@ -36,13 +55,38 @@ void init(struct task_t* task, int* execution, int size)
 /// @return None
 ///-------------------------------------------------
 void first_come_first_served(struct task_t* task, int size)
+{
+    struct trace_sink_t console;
+
+    // Print times to console
+    trace_open(&console, TRACE_TEXT, stdout);
+    first_come_first_served_traced(task, size, &console);
+    trace_close(&console);
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler
+///         algorithm, emitting the times of each
+///         task to a trace sink
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] trace Sink for the times, or NULL
+///
+/// @return None
+///-------------------------------------------------
+void first_come_first_served_traced(struct task_t* task, int size, struct trace_sink_t* trace)
 {
     int runTime = 0;
+    struct run_metrics_t metrics;
 
     // Construct a task queue from the task array
     struct node_t* queue = create_queue(task, size);
     struct task_t* currentTask;
 
+    trace_begin(trace, &metrics);
+
     while(!is_empty(&queue))
     {
         // "Execute" the first task
@@ -53,22 +97,315 @@ void first_come_first_served(struct task_t* task, int size)
 
         pop(&queue);
 
-        // Print times to console
-        printf("\nTask[%d] Wait Time: %d\n", currentTask->process_id, currentTask->waiting_time);
-        printf("Task[%d] Turnaround Time: %d\n", currentTask->process_id, currentTask->turnaround_time);
+        run_metrics_add(&metrics, currentTask->waiting_time, currentTask->turnaround_time);
+        trace_event(trace, currentTask->process_id, currentTask->waiting_time, currentTask->turnaround_time);
     }
-    
-    // Calculate average times
-    float avgWaitTime = calculate_average_wait_time(task, size);
-    float avgTurnaroundTime = calculate_average_turn_around_time(task, size);
 
-    // Print average times
-    printf("Average Wait Time: %f\n", avgWaitTime);
-    printf("Average Turnaround Time: %f\n", avgTurnaroundTime);
+    // The averages come from the running sums, with
+    // no second pass over the tasks
+    trace_finish(trace, &metrics);
+
+    // Cleanup
+    empty_queue(&queue);
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler as a
+///         prefix sum over the task array
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+///
+/// @return None
+///-------------------------------------------------
+void first_come_first_served_fast(struct task_t* task, int size)
+{
+    int runTime = 0;
+
+    prefixSum(task, size, &runTime);
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler driven
+///         by arrival and completion events
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] trace Sink for the times, or NULL
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int first_come_first_served_events(struct task_t* task, int size, struct trace_sink_t* trace)
+{
+    struct event_queue_t events;
+    struct node_t* queue = create_empty_queue();
+    struct task_t* running = NULL;
+    struct event_t event;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    // Every arrival plus the one completion pending
+    // at any time
+    if((queue == NULL) || event_queue_init(&events, size + 1))
+    {
+        empty_queue(&queue);
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    // NOTE: Pushing in array order makes tasks which
+    //       arrive together run in array order
+    for(int i = 0; i < size; i++)
+    {
+        event_push(&events, task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    while(!event_queue_is_empty(&events))
+    {
+        event_pop(&events, &event);
+
+        if(event.kind == EVENT_ARRIVAL)
+        {
+            push(&queue, &(task[event.index]));
+        }
+        else
+        {
+            run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+            trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+            running = NULL;
+        }
+
+        // "Execute" the first waiting task once the CPU
+        // is free; its times are known from the start
+        if((running == NULL) && !is_empty(&queue))
+        {
+            running = peek(&queue);
+            pop(&queue);
+
+            running->waiting_time = (int)(event.time - running->arrival_time);
+            running->turnaround_time = running->waiting_time + running->execution_time;
+
+            if(event_push(&events, event.time + running->execution_time, EVENT_COMPLETION, (int)(running - task)))
+            {
+                status = 1;
+                break;
+            }
+        }
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    // Cleanup
+    empty_queue(&queue);
+    event_queue_free(&events);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler over
+///         a workload file, one chunk at a time
+///
+/// @param[in] reader The open workload file
+/// @param[in] trace Sink for the times, or NULL
+///
+/// @return Number of tasks; -1: Error
+///-------------------------------------------------
+long long first_come_first_served_stream(struct workload_reader_t* reader, struct trace_sink_t* trace)
+{
+    struct task_t* task = (struct task_t*)malloc(STREAM_CHUNK * sizeof(struct task_t));
+
+    if(task == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't allocate chunk!\n", __func__);
+        return -1;
+    }
+
+    long long tasks = 0;
+    struct run_metrics_t metrics;
+    long long runTime = 0;
+    int overflow = 0;
+    int count;
+
+    trace_begin(trace, &metrics);
+
+    while((count = workload_read(reader, task, STREAM_CHUNK)) > 0)
+    {
+        int arrivesLate = 0;
+        long long chunkEnd = runTime;
+
+        for(int i = 0; i < count; i++)
+        {
+            arrivesLate |= task[i].arrival_time;
+            chunkEnd += task[i].execution_time;
+        }
+
+        if(!arrivesLate)
+        {
+            // Everything is already waiting, so the chunk
+            // is a plain prefix sum, as long as its last
+            // turnaround time fits
+            int chunkTime = (int)runTime;
+
+            overflow = (chunkEnd > INT_MAX);
+
+            if(!overflow)
+            {
+                prefixSum(task, count, &chunkTime);
+                runTime = chunkTime;
+            }
+        }
+        else
+        {
+            for(int i = 0; (i < count) && !overflow; i++)
+            {
+                // The CPU idles until the task arrives
+                long long arrival = task[i].arrival_time;
+                long long start = (runTime > arrival) ? runTime : arrival;
+
+                runTime = start + task[i].execution_time;
+                overflow = ((runTime - arrival) > INT_MAX);
+                task[i].waiting_time = (int)(start - arrival);
+                task[i].turnaround_time = (int)(runTime - arrival);
+            }
+        }
+
+        if(overflow)
+        {
+            fprintf(stderr, "%s() ERROR: Turnaround time doesn't fit in an int!\n", __func__);
+            count = -1;
+            break;
+        }
+
+        for(int i = 0; i < count; i++)
+        {
+            run_metrics_add(&metrics, task[i].waiting_time, task[i].turnaround_time);
+
+            trace_event(trace, task[i].process_id, task[i].waiting_time, task[i].turnaround_time);
+        }
+
+        tasks += count;
+    }
+
+    if(count == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    free(task);
+
+    return (count < 0) ? -1 : tasks;
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler over
+///         tasks handed in by other threads while
+///         it runs
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] intake Queue of the other tasks
+/// @param[in] drain_limit Most tasks taken from
+///                        the intake after a task
+/// @param[in] trace Sink for the times, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int first_come_first_served_live(struct task_t* task, int size, struct intake_queue_t* intake, int drain_limit,
+                                 struct trace_sink_t* trace)
+{
+    struct node_t* queue = NULL;
+    struct task_t* currentTask;
+    long long runTime = 0;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    if(drain_limit < 1)
+    {
+        fprintf(stderr, "%s() ERROR: Drain limit must be at least 1!\n", __func__);
+        return 1;
+    }
+
+    queue = create_empty_queue();
+
+    if(queue == NULL)
+    {
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; (i < size) && (status == 0); i++)
+    {
+        task[i].arrival_time = 0;
+        status = queueTask(&queue, &(task[i]));
+    }
+
+    if((status == 0) && (drainIntake(intake, &queue, runTime, drain_limit) < 0))
+    {
+        status = 1;
+    }
+
+    while(status == 0)
+    {
+        if(is_empty(&queue))
+        {
+            // NOTE: Read before draining, so a closed and
+            //       empty intake can't be refilled behind it
+            int closed = intake_is_closed(intake);
+            int moved = drainIntake(intake, &queue, runTime, drain_limit);
+
+            if(moved < 0)
+            {
+                status = 1;
+            }
+            else if(moved == 0)
+            {
+                if(closed)
+                {
+                    break;
+                }
+
+                sched_yield();
+            }
+
+            continue;
+        }
+
+        // "Execute" the first task
+        currentTask = peek(&queue);
+        currentTask->waiting_time = (int)(runTime - currentTask->arrival_time);
+        runTime += currentTask->execution_time;
+        currentTask->turnaround_time = (int)(runTime - currentTask->arrival_time);
+
+        pop(&queue);
+
+        run_metrics_add(&metrics, currentTask->waiting_time, currentTask->turnaround_time);
+        trace_event(trace, currentTask->process_id, currentTask->waiting_time, currentTask->turnaround_time);
+
+        if(drainIntake(intake, &queue, runTime, drain_limit) < 0)
+        {
+            status = 1;
+        }
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
 
     // Cleanup
-    free(queue->next);
-    free(queue);
+    empty_queue(&queue);
+
+    return status;
 }
 
 
@@ -84,14 +421,16 @@ void first_come_first_served(struct task_t* task, int size)
 ///-------------------------------------------------
 float calculate_average_wait_time(struct task_t* task, int size)
 {
-    float totalTime = 0;
+    // NOTE: A float sum stops counting single time
+    //       units past 2^24
+    long long totalTime = 0;
 
     for(int i = 0; i < size; i++)
     {
         totalTime += task[i].waiting_time;
     }
     
-    return totalTime / size;
+    return (float)((double)totalTime / size);
 }
 
 
@@ -103,12 +442,97 @@ float calculate_average_wait_time(struct task_t* task, int size)
 ///-------------------------------------------------
 float calculate_average_turn_around_time(struct task_t* task, int size)
 {
-    float totalTime = 0;
+    // NOTE: A float sum stops counting single time
+    //       units past 2^24
+    long long totalTime = 0;
 
     for(int i = 0; i < size; i++)
     {
         totalTime += task[i].turnaround_time;
     }
     
-    return totalTime / size;
-}
\ No newline at end of file
+    return (float)((double)totalTime / size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Prefix sum the execution times of the
+///         tasks into their wait and turnaround
+///         times
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in,out] runTime Time the first task
+///                        starts; updated to the
+///                        time the last task ends
+///-------------------------------------------------
+static void prefixSum(struct task_t* task, int size, int* runTime)
+{
+    // NOTE: A 4-wide kernel loses to this loop here:
+    //       gathering and scattering the fields of
+    //       task_t costs more than the adds it saves
+    //       (see task_set_first_come_first_served()
+    //       for the vectorized scan)
+    int time = *runTime;
+
+    for(int i = 0; i < size; i++)
+    {
+        task[i].waiting_time = time;
+        time += task[i].execution_time;
+        task[i].turnaround_time = time;
+    }
+
+    *runTime = time;
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task, checking that its node
+///         could be allocated
+///
+/// @param[in] queue The task queue
+/// @param[in] task The task
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int queueTask(struct node_t** queue, struct task_t* task)
+{
+    int size = queue_size(queue);
+
+    push(queue, task);
+
+    return queue_size(queue) == size;
+}
+
+
+///-------------------------------------------------
+/// @brief  Move tasks from the intake to the end
+///         of the queue, arriving now
+///
+/// @param[in] intake The intake queue
+/// @param[in] queue The task queue
+/// @param[in] now Current time
+/// @param[in] limit Most tasks to move
+///
+/// @return The number of tasks moved; -1: A task
+///         was taken but couldn't be queued
+///-------------------------------------------------
+static int drainIntake(struct intake_queue_t* intake, struct node_t** queue, long long now, int limit)
+{
+    struct task_t* task;
+    int moved = 0;
+
+    while((moved < limit) && ((task = intake_pop(intake)) != NULL))
+    {
+        task->arrival_time = (int)now;
+
+        if(queueTask(queue, task))
+        {
+            return -1;
+        }
+
+        moved++;
+    }
+
+    return moved;
+}
@@ -2,6 +2,11 @@
 #ifndef __FIRST_COME_FIRST_SERVED__
 #define __FIRST_COME_FIRST_SERVED__
 
+#include "trace.h"
+
+struct workload_reader_t;
+struct intake_queue_t;
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Structure which holds the Task information
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -18,6 +23,11 @@ struct task_t {
 
     // Amount of time the task spends in the queue
     int turnaround_time;
+
+    // Time at which the task arrives; only first_come_first_served_events() and
+    // first_come_first_served_stream() honour it, and first_come_first_served_live() sets it;
+    // everything else treats every task as arriving at 0
+    int arrival_time;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -38,9 +48,96 @@ void init(struct task_t *task, int *execution, int size);
 //----------------------------------------------------------------------------------------------------------------------------------
 void first_come_first_served(struct task_t *task, int size);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the first come first served algorithm and
+/// calculate the wait and turn around time for each task,
+/// emitting the times of each task to a trace sink
+///
+/// @note first_come_first_served() is this with a TRACE_TEXT sink on stdout
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+//----------------------------------------------------------------------------------------------------------------------------------
+void first_come_first_served_traced(struct task_t *task, int size, struct trace_sink_t *trace);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Calculate the first come first served wait and turn around time for each task without
+/// building a queue or printing anything
+///
+/// @note Every task arrives at time 0, so the wait and turn around times are the exclusive and
+///       inclusive prefix sums of the execution times, computed in one scalar pass. The fields of
+///       task_t are interleaved, so a vector scan would spend more on gathering and scattering
+///       them than it saves; task_set_first_come_first_served() is the vectorized version.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+//----------------------------------------------------------------------------------------------------------------------------------
+void first_come_first_served_fast(struct task_t *task, int size);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the first come first served algorithm as a discrete-event simulation in which every
+/// task arrives at its arrival time, emitting the times of each task to a trace sink when it ends
+///
+/// @note Arrivals and completions are kept in a min-heap (see events.h) and the clock jumps from
+///       one event to the next, so idle gaps cost nothing and the tasks needn't be sorted by
+///       arrival time. Tasks arriving at the same time are served in array order. Wait and
+///       turn around times are measured from the arrival time.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int first_come_first_served_events(struct task_t *task, int size, struct trace_sink_t *trace);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the first come first served algorithm over every task of a workload file, a chunk
+/// at a time, emitting the times of each task to a trace sink as soon as they are known
+///
+/// @note Memory use doesn't depend on the size of the file. Tasks run in file order; a task with
+///       an arrival time waits for it, so the file must be sorted by arrival time. The clock is
+///       64 bits wide, but the wait and turn around times of task_t are ints: the run stops at the
+///       first chunk holding a turn around time above INT_MAX, after the chunks before it were
+///       emitted.
+///
+/// @param[in] reader The open workload file (see workload.h)
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+///
+/// @return The number of tasks scheduled, -1 if the file is malformed, a turn around time doesn't
+///         fit in an int or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+long long first_come_first_served_stream(struct workload_reader_t *reader, struct trace_sink_t *trace);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the first come first served algorithm on a set of tasks which keeps growing while it
+/// runs, emitting the times of each task to a trace sink when it ends
+///
+/// @note Other threads hand in tasks through the intake queue (see intake.h). After every task at
+///       most drain_limit of them are moved to the end of the queue, so a burst of pushes can't
+///       stall the tasks. A task arrives at the time it is moved to the queue, and its arrival_time
+///       is set to it; the tasks of the buffer arrive at 0. When no task is waiting the scheduler
+///       keeps taking from the intake, yielding the CPU in between, and it returns once the intake
+///       is closed and empty and every task has run.
+///
+/// @param[in] task The buffer containing the tasks known before the run, may be NULL if size is 0
+/// @param[in] size The size of the buffer
+/// @param[in] intake The queue the other tasks come through
+/// @param[in] drain_limit The most tasks taken from the intake after a task, at least 1
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+///
+/// @return 0 on success, 1 if drain_limit is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int first_come_first_served_live(struct task_t *task, int size, struct intake_queue_t *intake, int drain_limit,
+                                 struct trace_sink_t *trace);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Calculates the average wait time.
 ///
+/// @note This takes another pass over the tasks; the schedulers keep the same average, and more, in
+///       the metrics of their trace sink as they run (see metrics.h)
+///
 /// @param[in] task The buffer containing task data
 /// @param[in] size The size of the buffer
 ///
@@ -51,6 +148,9 @@ float calculate_average_wait_time(struct task_t *task, int size);
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Calculates the average turn around time.
 ///
+/// @note This takes another pass over the tasks; the schedulers keep the same average, and more, in
+///       the metrics of their trace sink as they run (see metrics.h)
+///
 /// @param[in] task The buffer containing task data
 /// @param[in] size The size of the buffer
 ///
@@ -0,0 +1,143 @@
+#include "fcfs_multicore.h"
+
+
+static long long runGlobal(struct task_t* task, int size, int cores, struct core_stats_t* stats);
+static long long runPartitioned(struct task_t* task, int size, const struct multicore_config_t* config, struct core_stats_t* stats);
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler over
+///         several cores
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] config The processors
+/// @param[out] stats Statistics of each core, or
+///                   NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int first_come_first_served_multicore(struct task_t* task, int size, const struct multicore_config_t* config,
+                                      struct core_stats_t* stats)
+{
+    if((config == NULL) || (config->cores < 1))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid core count!\n", __func__);
+        return 1;
+    }
+
+    struct core_stats_t* core = (stats != NULL) ? stats : (struct core_stats_t*)malloc((size_t)config->cores * sizeof(struct core_stats_t));
+
+    if(core == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create core statistics!\n", __func__);
+        return 1;
+    }
+
+    long long makespan = (config->mode == MULTICORE_PARTITIONED) ? runPartitioned(task, size, config, core)
+                                                                 : runGlobal(task, size, config->cores, core);
+
+    if(makespan >= 0)
+    {
+        cores_utilization(core, config->cores, makespan);
+    }
+
+    if(stats == NULL)
+    {
+        free(core);
+    }
+
+    return (makespan < 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Start each task on the core which frees
+///         up first
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] cores Number of cores
+/// @param[out] stats Statistics of each core
+///
+/// @return Makespan; -1: Allocation failed
+///-------------------------------------------------
+static long long runGlobal(struct task_t* task, int size, int cores, struct core_stats_t* stats)
+{
+    struct core_tree_t freeAt;
+    long long makespan = 0;
+
+    if(core_tree_init(&freeAt, cores))
+    {
+        return -1;
+    }
+
+    for(int i = 0; i < cores; i++)
+    {
+        stats[i].busy_time = 0;
+        stats[i].tasks = 0;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        int core = core_tree_min(&freeAt);
+        long long start = core_tree_key(&freeAt, core);
+        long long end = start + task[i].execution_time;
+
+        task[i].waiting_time = (int)start;
+        task[i].turnaround_time = (int)end;
+
+        core_tree_set(&freeAt, core, end);
+        stats[core].busy_time += task[i].execution_time;
+        stats[core].tasks++;
+
+        makespan = (end > makespan) ? end : makespan;
+    }
+
+    core_tree_free(&freeAt);
+
+    return makespan;
+}
+
+
+///-------------------------------------------------
+/// @brief  Assign the tasks to cores, then run each
+///         core's tasks back to back
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] config The processors
+/// @param[out] stats Statistics of each core
+///
+/// @return Makespan; -1: Allocation failed
+///-------------------------------------------------
+static long long runPartitioned(struct task_t* task, int size, const struct multicore_config_t* config, struct core_stats_t* stats)
+{
+    // NOTE: One spare entry keeps an empty task
+    //       array from asking malloc for 0 bytes
+    int* core = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    long long* clock = (long long*)calloc((size_t)config->cores, sizeof(long long));
+    long long makespan = 0;
+
+    if((core == NULL) || (clock == NULL) || cores_partition(task, size, config, core, stats))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't partition the tasks!\n", __func__);
+        free(core);
+        free(clock);
+        return -1;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        task[i].waiting_time = (int)clock[core[i]];
+        clock[core[i]] += task[i].execution_time;
+        task[i].turnaround_time = (int)clock[core[i]];
+
+        makespan = (clock[core[i]] > makespan) ? clock[core[i]] : makespan;
+    }
+
+    free(core);
+    free(clock);
+
+    return makespan;
+}
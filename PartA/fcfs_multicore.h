@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "fcfs.h"
+#include "cores.h"
+
+#ifndef __FCFS_MULTICORE__
+#define __FCFS_MULTICORE__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the first come first served algorithm on several cores and calculate the wait and
+/// turn around time for each task
+///
+/// @note With MULTICORE_GLOBAL the next task in the array starts on whichever core frees up
+///       first (the lowest numbered one on a tie). With MULTICORE_PARTITIONED each core runs the
+///       tasks assigned to it in array order. Either way a core is picked in O(log cores).
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] config The processors
+/// @param[out] stats The buffer receiving the statistics of each core, one entry per core; may be
+///                   NULL
+///
+/// @return 0 on success, 1 if the configuration is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int first_come_first_served_multicore(struct task_t *task, int size, const struct multicore_config_t *config,
+                                      struct core_stats_t *stats);
+
+#endif // __FCFS_MULTICORE__
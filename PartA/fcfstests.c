@@ -1,6 +1,14 @@
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "ctest.h"
 #include "fcfs.h"
+#include "queue.h"
+#include "taskset.h"
+#include "workload.h"
+#include "fcfs_multicore.h"
+#include "sjf.h"
+#include "intake.h"
 
 
 ///-------------------------------------------------
@@ -158,6 +166,718 @@ CTEST2(customFCFS, largerTaskQueue_process)
 }
 
 
+///-------------------------------------------------
+/// @brief   Validate that the prefix sum fast path
+///          matches the queue based scheduler on a
+///          task count that isn't a multiple of the
+///          vector width
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST2(customFCFS, prefixSumFastPath_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_t task[10];
+
+    init(task, execution, data->size);
+    first_come_first_served_fast(task, data->size);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        ASSERT_EQUAL(data->task[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(data->task[i].turnaround_time, task[i].turnaround_time);
+        ASSERT_EQUAL(i, task[i].process_id);
+        ASSERT_EQUAL(execution[i], task[i].execution_time);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief   Validate the structure-of-arrays task
+///          set against the task array scheduler,
+///          including the conversion helpers
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST2(customFCFS, taskSet_process)
+{
+    struct task_set_t set;
+    struct task_t task[10];
+
+    ASSERT_EQUAL(0, task_set_create(&set, data->size));
+
+    task_set_from_tasks(&set, data->task);
+    task_set_first_come_first_served(&set);
+
+    ASSERT_DBL_NEAR(calculate_average_wait_time(data->task, data->size), task_set_average_wait_time(&set));
+    ASSERT_DBL_NEAR(calculate_average_turn_around_time(data->task, data->size), task_set_average_turn_around_time(&set));
+
+    task_set_to_tasks(&set, task);
+    task_set_free(&set);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        ASSERT_EQUAL(data->task[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(data->task[i].turnaround_time, task[i].turnaround_time);
+        ASSERT_EQUAL(i, task[i].process_id);
+    }
+}
+
+///-------------------------------------------------
+/// @brief  Validate that a task set mapped onto
+///         column files schedules in place and
+///         the results can be mapped back
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST2(customFCFS, mappedColumns_process)
+{
+    char workloadPath[] = "/tmp/fcfsworkloadXXXXXX";
+    char resultsPath[] = "/tmp/fcfsresultsXXXXXX";
+    struct column_desc_t workloadColumns[] = {{COLUMN_EXECUTION_TIME, 4, 0}, {COLUMN_ARRIVAL_TIME, 8, 0}};
+    struct column_desc_t resultColumns[] = {{COLUMN_WAITING_TIME, 4, 0}, {COLUMN_TURNAROUND_TIME, 4, 0}};
+    struct column_file_t workload;
+    struct column_file_t results;
+    struct task_set_t set;
+    int width = 0;
+
+    close(mkstemp(workloadPath));
+    close(mkstemp(resultsPath));
+
+    ASSERT_EQUAL(0, column_file_create(&workload, workloadPath, data->size, workloadColumns, 2));
+
+    int* execution = (int*)column_file_column(&workload, COLUMN_EXECUTION_TIME, NULL);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        execution[i] = data->task[i].execution_time;
+    }
+
+    column_file_close(&workload);
+
+    // Map the workload back read-only
+    ASSERT_EQUAL(0, column_file_open(&workload, workloadPath));
+    ASSERT_NOT_NULL(column_file_column(&workload, COLUMN_ARRIVAL_TIME, &width));
+    ASSERT_EQUAL(8, width);
+    ASSERT_NULL(column_file_column(&workload, COLUMN_PRIORITY, NULL));
+
+    ASSERT_EQUAL(0, column_file_create(&results, resultsPath, data->size, resultColumns, 2));
+    ASSERT_EQUAL(0, task_set_map(&set, &workload, &results));
+
+    // The engine works on the mappings themselves
+    ASSERT_TRUE(set.execution_time == column_file_column(&workload, COLUMN_EXECUTION_TIME, NULL));
+    ASSERT_TRUE(set.waiting_time == column_file_column(&results, COLUMN_WAITING_TIME, NULL));
+
+    task_set_first_come_first_served(&set);
+    task_set_free(&set);
+
+    ASSERT_EQUAL(0, column_file_sync(&results));
+    column_file_close(&results);
+    column_file_close(&workload);
+
+    ASSERT_EQUAL(0, column_file_open(&results, resultsPath));
+    ASSERT_EQUAL(data->size, results.rows);
+
+    int* waiting = (int*)column_file_column(&results, COLUMN_WAITING_TIME, NULL);
+    int* turnaround = (int*)column_file_column(&results, COLUMN_TURNAROUND_TIME, NULL);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        ASSERT_EQUAL(data->task[i].waiting_time, waiting[i]);
+        ASSERT_EQUAL(data->task[i].turnaround_time, turnaround[i]);
+    }
+
+    // Results hold no execution times and are
+    // mapped read-only
+    ASSERT_EQUAL(1, task_set_map(&set, &results, &results));
+
+    column_file_close(&results);
+    unlink(workloadPath);
+    unlink(resultsPath);
+}
+
+
+
+///-------------------------------------------------
+/// @brief   Validate that the text trace sink
+///          writes the same lines the scheduler
+///          used to print, and that a NULL sink
+///          still schedules every task
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(traceFCFS, textSink_process)
+{
+    int execution[] = {1, 2};
+    struct task_t task[2];
+    struct trace_sink_t trace;
+    char text[256] = {0};
+    FILE* stream = tmpfile();
+
+    ASSERT_NOT_NULL(stream);
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_TEXT, stream));
+
+    init(task, execution, 2);
+    first_come_first_served_traced(task, 2, &trace);
+    trace_close(&trace);
+
+    rewind(stream);
+    fread(text, 1, sizeof(text) - 1, stream);
+    fclose(stream);
+
+    ASSERT_EQUAL(2, trace.events);
+    ASSERT_STR("\nTask[0] Wait Time: 0\nTask[0] Turnaround Time: 1\n"
+               "\nTask[1] Wait Time: 1\nTask[1] Turnaround Time: 3\n"
+               "Average Wait Time: 0.500000\nAverage Turnaround Time: 2.000000\n", text);
+
+    init(task, execution, 2);
+    first_come_first_served_traced(task, 2, NULL);
+    ASSERT_EQUAL(3, task[1].turnaround_time);
+}
+
+
+///-------------------------------------------------
+/// @brief   Validate the running summaries against
+///          a second pass over the tasks, and that
+///          a sink merges the runs emitted to it
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(metricsFCFS, onlineSummary_process)
+{
+    int execution[] = {4, 1, 7, 2, 5};
+    int longer[] = {20000000, 20000001, 3};
+    struct task_t task[5];
+    struct trace_sink_t trace;
+    struct metric_t first;
+    struct metric_t second;
+
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+
+    // Waits 0, 4, 5, 12 and 14
+    init(task, execution, 5);
+    first_come_first_served_traced(task, 5, &trace);
+
+    ASSERT_EQUAL(5, trace.metrics.wait.count);
+    ASSERT_EQUAL(35, trace.metrics.wait.sum);
+    ASSERT_EQUAL(0, trace.metrics.wait.min);
+    ASSERT_EQUAL(14, trace.metrics.wait.max);
+    ASSERT_DBL_NEAR(7.0, metric_mean(&(trace.metrics.wait)));
+    ASSERT_DBL_NEAR(27.2, metric_variance(&(trace.metrics.wait)));
+    ASSERT_DBL_NEAR(calculate_average_turn_around_time(task, 5), metric_mean(&(trace.metrics.turnaround)));
+    ASSERT_EQUAL(19, trace.metrics.turnaround.max);
+
+    // Past 2^24 the sum still counts single units
+    init(task, longer, 3);
+    first_come_first_served_traced(task, 3, &trace);
+
+    ASSERT_EQUAL(8, trace.metrics.wait.count);
+    ASSERT_EQUAL(35 + 20000000 + 40000001, trace.metrics.wait.sum);
+    ASSERT_EQUAL(40000004, trace.metrics.turnaround.max);
+    trace_close(&trace);
+
+    // Merging halves gives the variance of the whole
+    metric_init(&first);
+    metric_init(&second);
+
+    for(int i = 0; i < 5; i++)
+    {
+        metric_add((i < 2) ? &first : &second, execution[i]);
+    }
+
+    metric_merge(&first, &second);
+    ASSERT_EQUAL(5, first.count);
+    ASSERT_EQUAL(1, first.min);
+    ASSERT_EQUAL(7, first.max);
+    ASSERT_DBL_NEAR(3.8, metric_mean(&first));
+    ASSERT_DBL_NEAR(4.56, metric_variance(&first));
+}
+
+
+///-------------------------------------------------
+/// @brief   Validate the tail percentiles a sink
+///          keeps of a run, and that histograms
+///          merge
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(histogramFCFS, tailPercentiles_process)
+{
+    int size = 1000;
+    int execution[1000];
+    struct task_t task[1000];
+    struct trace_sink_t trace;
+    struct histogram_t merged;
+    struct latency_percentiles_t wait;
+    struct latency_percentiles_t turnaround;
+
+    for(int i = 0; i < size; i++)
+    {
+        execution[i] = 1;
+    }
+
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+    ASSERT_EQUAL(0, trace_keep_histograms(&trace));
+
+    // Waits 0 to 999; above 255 a bucket is 2 or 4
+    // wide and reports its top, up to the maximum
+    init(task, execution, size);
+    first_come_first_served_traced(task, size, &trace);
+    histogram_percentiles(&(trace.wait_histogram), &wait);
+    histogram_percentiles(&(trace.turnaround_histogram), &turnaround);
+
+    ASSERT_EQUAL(499, wait.p50);
+    ASSERT_EQUAL(899, wait.p90);
+    ASSERT_EQUAL(991, wait.p99);
+    ASSERT_EQUAL(999, wait.p999);
+    ASSERT_EQUAL(999, wait.max);
+    ASSERT_EQUAL(501, turnaround.p50);
+    ASSERT_EQUAL(1000, turnaround.max);
+    ASSERT_EQUAL(3, histogram_percentile(&(trace.wait_histogram), 0.4));
+
+    // Two copies of a run have the same percentiles
+    ASSERT_EQUAL(0, histogram_init(&merged));
+    histogram_merge(&merged, &(trace.wait_histogram));
+    histogram_merge(&merged, &(trace.wait_histogram));
+    ASSERT_EQUAL(2 * size, merged.count);
+    ASSERT_EQUAL(991, histogram_percentile(&merged, 99));
+
+    histogram_free(&merged);
+    trace_close(&trace);
+    ASSERT_NULL(trace.wait_histogram.bucket);
+}
+
+
+///-------------------------------------------------
+/// @brief  Tasks one producer thread hands to the
+///         live scheduler
+///-------------------------------------------------
+struct intake_producer_t {
+    // Queue the tasks are pushed to
+    struct intake_queue_t* intake;
+
+    // Tasks to push, in order
+    struct task_t* task;
+
+    // Links of the tasks
+    struct intake_node_t* node;
+
+    // Number of tasks
+    int size;
+
+    // Producers still pushing, shared by all of them
+    int* running;
+};
+
+
+///-------------------------------------------------
+/// @brief  Push every task of a producer, yielding
+///         now and then so the scheduler runs in
+///         between; the last producer to finish
+///         closes the intake
+///
+/// @param[in] arg The producer
+///
+/// @return NULL
+///-------------------------------------------------
+static void* produceTasks(void* arg)
+{
+    struct intake_producer_t* producer = (struct intake_producer_t*)arg;
+
+    for(int i = 0; i < producer->size; i++)
+    {
+        intake_push(producer->intake, &(producer->node[i]), &(producer->task[i]));
+
+        if((i % 64) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    if(__atomic_sub_fetch(producer->running, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        intake_close(producer->intake);
+    }
+
+    return NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the live scheduler takes a
+///         bounded number of tasks from its intake
+///         after each task, and runs the tasks of
+///         several producer threads in the order
+///         each of them pushed them
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(liveFCFS, intakeProducers_process)
+{
+    int execution[] = {4, 1};
+    int handedIn[] = {3, 2};
+    struct task_t task[2];
+    struct task_t late[2];
+    struct intake_node_t lateNode[2];
+    struct intake_queue_t intake;
+
+    init(task, execution, 2);
+    init(late, handedIn, 2);
+
+    // One task taken after each task: the first late
+    // task arrives at 0, the second once task 0 ends
+    intake_init(&intake);
+    intake_push(&intake, &(lateNode[0]), &(late[0]));
+    intake_push(&intake, &(lateNode[1]), &(late[1]));
+    intake_close(&intake);
+
+    ASSERT_EQUAL(0, first_come_first_served_live(task, 2, &intake, 1, NULL));
+    ASSERT_EQUAL(0, task[0].waiting_time);
+    ASSERT_EQUAL(4, task[0].turnaround_time);
+    ASSERT_EQUAL(4, task[1].waiting_time);
+    ASSERT_EQUAL(5, task[1].turnaround_time);
+    ASSERT_EQUAL(0, late[0].arrival_time);
+    ASSERT_EQUAL(5, late[0].waiting_time);
+    ASSERT_EQUAL(8, late[0].turnaround_time);
+    ASSERT_EQUAL(4, late[1].arrival_time);
+    ASSERT_EQUAL(4, late[1].waiting_time);
+    ASSERT_EQUAL(6, late[1].turnaround_time);
+    ASSERT_NULL(intake_pop(&intake));
+
+    // Producers race the scheduler, which returns
+    // only once the intake is closed and empty
+    enum { PRODUCERS = 4, PER_PRODUCER = 2000 };
+    struct task_t* produced = (struct task_t*)malloc(PRODUCERS * PER_PRODUCER * sizeof(struct task_t));
+    struct intake_node_t* node = (struct intake_node_t*)malloc(PRODUCERS * PER_PRODUCER * sizeof(struct intake_node_t));
+    struct intake_producer_t producer[PRODUCERS];
+    pthread_t thread[PRODUCERS];
+    struct trace_sink_t trace;
+    int running = PRODUCERS;
+
+    ASSERT_TRUE((produced != NULL) && (node != NULL));
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+
+    for(int i = 0; i < PRODUCERS * PER_PRODUCER; i++)
+    {
+        produced[i].process_id = 100 + i;
+        produced[i].execution_time = 1 + (i % 7);
+    }
+
+    init(task, execution, 2);
+    intake_init(&intake);
+
+    for(int i = 0; i < PRODUCERS; i++)
+    {
+        producer[i].intake = &intake;
+        producer[i].task = produced + (i * PER_PRODUCER);
+        producer[i].node = node + (i * PER_PRODUCER);
+        producer[i].size = PER_PRODUCER;
+        producer[i].running = &running;
+        ASSERT_EQUAL(0, pthread_create(&(thread[i]), NULL, produceTasks, &(producer[i])));
+    }
+
+    ASSERT_EQUAL(0, first_come_first_served_live(task, 2, &intake, 8, &trace));
+
+    for(int i = 0; i < PRODUCERS; i++)
+    {
+        ASSERT_EQUAL(0, pthread_join(thread[i], NULL));
+    }
+
+    ASSERT_EQUAL(2 + (PRODUCERS * PER_PRODUCER), trace.metrics.turnaround.count);
+
+    // Each producer's tasks start in push order
+    for(int i = 0; i < PRODUCERS * PER_PRODUCER; i++)
+    {
+        struct task_t* current = &(produced[i]);
+
+        ASSERT_EQUAL(current->execution_time, current->turnaround_time - current->waiting_time);
+
+        if((i % PER_PRODUCER) != 0)
+        {
+            ASSERT_TRUE((current - 1)->arrival_time + (current - 1)->turnaround_time <=
+                        current->arrival_time + current->waiting_time);
+        }
+    }
+
+    ASSERT_EQUAL(1, first_come_first_served_live(task, 2, &intake, 0, NULL));
+
+    trace_close(&trace);
+    free(produced);
+    free(node);
+}
+
+///-------------------------------------------------
+/// @brief  Validate that a streamed CSV workload,
+///         including an idle gap before a late
+///         arrival, and a binary workload are
+///         scheduled like the task array
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(streamFCFS, workloadFile_process)
+{
+    struct workload_reader_t reader;
+    struct trace_sink_t trace;
+    struct trace_event_t event[4];
+    struct workload_record_t record[2] = {{7, 3, 0}, {8, 4, 0}};
+    FILE* csv = tmpfile();
+    FILE* binary = tmpfile();
+    FILE* events = tmpfile();
+
+    ASSERT_NOT_NULL(csv);
+    ASSERT_NOT_NULL(binary);
+    ASSERT_NOT_NULL(events);
+
+    // Ids are given to the last two tasks, which
+    // arrive after the first two have finished
+    fputs("id,burst,arrival\n# comment\n\n2\n3\n5, 4, 10\n6,1,12\n", csv);
+    rewind(csv);
+
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_BINARY, events));
+    workload_attach(&reader, csv, WORKLOAD_CSV);
+    ASSERT_EQUAL(4, first_come_first_served_stream(&reader, &trace));
+    workload_close(&reader);
+    trace_close(&trace);
+
+    rewind(events);
+    ASSERT_EQUAL(4, (int)fread(event, sizeof(struct trace_event_t), 4, events));
+
+    // Task 5 waits for its arrival at 10; task 6
+    // arrives at 12 but the CPU is busy until 14
+    int processId[] = {0, 1, 5, 6};
+    int waitTime[] = {0, 2, 0, 2};
+    int turnaroundTime[] = {2, 5, 4, 3};
+
+    for(int i = 0; i < 4; i++)
+    {
+        ASSERT_EQUAL(processId[i], event[i].process_id);
+        ASSERT_EQUAL(waitTime[i], event[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], event[i].turnaround_time);
+    }
+
+    fwrite(record, sizeof(struct workload_record_t), 2, binary);
+    rewind(binary);
+
+    workload_attach(&reader, binary, WORKLOAD_BINARY);
+    ASSERT_EQUAL(2, first_come_first_served_stream(&reader, NULL));
+    ASSERT_EQUAL(2, reader.tasks_read);
+    workload_close(&reader);
+
+    // A malformed line fails the whole stream
+    rewind(csv);
+    fputs("1\n2x\n", csv);
+    rewind(csv);
+
+    workload_attach(&reader, csv, WORKLOAD_CSV);
+    ASSERT_EQUAL(-1, first_come_first_served_stream(&reader, NULL));
+    workload_close(&reader);
+
+    // So does a turnaround time past INT_MAX, with
+    // and without an arrival time in the chunk
+    struct workload_record_t huge[2][2] = {{{1, 2000000000, 0}, {2, 2000000000, 0}},
+                                          {{1, 2000000000, 0}, {2, 2000000000, 5}}};
+
+    for(int i = 0; i < 2; i++)
+    {
+        FILE* overflow = tmpfile();
+
+        ASSERT_NOT_NULL(overflow);
+        fwrite(huge[i], sizeof(struct workload_record_t), 2, overflow);
+        rewind(overflow);
+
+        workload_attach(&reader, overflow, WORKLOAD_BINARY);
+        ASSERT_EQUAL(-1, first_come_first_served_stream(&reader, NULL));
+        workload_close(&reader);
+        fclose(overflow);
+    }
+
+    fclose(csv);
+    fclose(binary);
+    fclose(events);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the times and utilization of
+///         two cores sharing one queue and of each
+///         assignment heuristic
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(multicoreFCFS, globalAndPartitioned_process)
+{
+    int execution[] = {5, 3, 8, 2, 4};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[5];
+    struct task_t single[5];
+    struct core_stats_t stats[2];
+    struct multicore_config_t config = multicore_default_config(2);
+
+    // Hand-calculated times for each configuration
+    int globalWait[] = {0, 0, 3, 5, 7};
+    int globalTurnaround[] = {5, 3, 11, 7, 11};
+    int firstFitWait[] = {0, 5, 0, 8, 8};
+    int firstFitTurnaround[] = {5, 8, 8, 10, 12};
+    int leastLoadedTurnaround[] = {5, 3, 13, 5, 17};
+
+    init(task, execution, size);
+    ASSERT_EQUAL(0, first_come_first_served_multicore(task, size, &config, stats));
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(globalWait[i], task[i].waiting_time);
+        ASSERT_EQUAL(globalTurnaround[i], task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(3, stats[0].tasks);
+    ASSERT_DBL_NEAR(1.0, stats[1].utilization);
+
+    // The first core fills up to half the work, and
+    // the last task fits nowhere
+    config.mode = MULTICORE_PARTITIONED;
+    init(task, execution, size);
+    ASSERT_EQUAL(0, first_come_first_served_multicore(task, size, &config, stats));
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(firstFitWait[i], task[i].waiting_time);
+        ASSERT_EQUAL(firstFitTurnaround[i], task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(10, stats[0].busy_time);
+    ASSERT_DBL_NEAR(10.0 / 12.0, stats[0].utilization);
+
+    config.fit = FIT_LEAST_LOADED;
+    init(task, execution, size);
+    ASSERT_EQUAL(0, first_come_first_served_multicore(task, size, &config, NULL));
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(leastLoadedTurnaround[i], task[i].turnaround_time);
+    }
+
+    // One core is plain first come first served
+    config = multicore_default_config(1);
+    init(task, execution, size);
+    init(single, execution, size);
+    ASSERT_EQUAL(0, first_come_first_served_multicore(task, size, &config, NULL));
+    first_come_first_served_fast(single, size);
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(single[i].waiting_time, task[i].waiting_time);
+    }
+
+    config.cores = 0;
+    ASSERT_EQUAL(1, first_come_first_served_multicore(task, size, &config, NULL));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the event-driven scheduler on
+///         unsorted arrivals with an idle gap, and
+///         against the prefix sum when every task
+///         arrives at 0
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(eventsFCFS, arrivals_process)
+{
+    int execution[] = {4, 3, 2, 1};
+    int arrival[] = {0, 10, 11, 2};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[4];
+    struct task_t single[4];
+
+    // Hand-calculated times; task 3 arrives while task
+    // 0 runs, and the CPU idles from 5 to 10
+    int waitTime[] = {0, 0, 2, 2};
+    int turnaroundTime[] = {4, 3, 4, 3};
+
+    init(task, execution, size);
+
+    for(int i = 0; i < size; i++)
+    {
+        task[i].arrival_time = arrival[i];
+    }
+
+    ASSERT_EQUAL(0, first_come_first_served_events(task, size, NULL));
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+    }
+
+    init(task, execution, size);
+    init(single, execution, size);
+    ASSERT_EQUAL(0, first_come_first_served_events(task, size, NULL));
+    first_come_first_served_fast(single, size);
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(single[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(single[i].turnaround_time, task[i].turnaround_time);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate shortest job first on
+///         staggered arrivals, and against first
+///         come first served when every task
+///         arrives at 0
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(sjf, shortestJobFirst_process)
+{
+    int execution[] = {8, 4, 9, 5};
+    int arrival[] = {0, 1, 2, 3};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[4];
+    struct task_t fcfs[4];
+
+    // Hand-calculated times; task 0 runs to completion
+    // before the shorter tasks which arrive meanwhile
+    int waitTime[] = {0, 7, 15, 9};
+    int turnaroundTime[] = {8, 11, 24, 14};
+
+    init(task, execution, size);
+
+    for(int i = 0; i < size; i++)
+    {
+        task[i].arrival_time = arrival[i];
+    }
+
+    ASSERT_EQUAL(0, shortest_job_first(task, size, NULL));
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+    }
+
+    // Arriving together, the tasks run shortest first
+    // and wait less on average than in array order
+    int together[] = {6, 8, 7, 3};
+    int togetherWait[] = {3, 16, 9, 0};
+
+    init(task, together, size);
+    init(fcfs, together, size);
+    ASSERT_EQUAL(0, shortest_job_first(task, size, NULL));
+    first_come_first_served_fast(fcfs, size);
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(togetherWait[i], task[i].waiting_time);
+    }
+
+    ASSERT_DBL_NEAR(7.0, calculate_average_wait_time(task, size));
+    ASSERT_DBL_NEAR(10.25, calculate_average_wait_time(fcfs, size));
+}
+
+
 ///-------------------------------------------------
 /// @brief  Dataset for the customFCFS2 unit-test
 ///
@@ -204,3 +924,79 @@ CTEST2(customFCFS2, nullQueue_process)
         ASSERT_EQUAL(i, data->task[i].process_id);
     }
 }
+
+
+///-------------------------------------------------
+/// @brief  Validate that the tail-tracked queue
+///         keeps FIFO order and its size when
+///         pushing onto an empty queue
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(queue, tailTracking_process)
+{
+    struct task_t task[3];
+    struct node_t* queue = create_empty_queue();
+
+    ASSERT_NOT_NULL(queue);
+    ASSERT_TRUE(is_empty(&queue));
+
+    // Drain the queue once in between to make sure
+    // the tail falls back to the sentinel
+    push(&queue, &task[0]);
+    pop(&queue);
+    ASSERT_TRUE(is_empty(&queue));
+
+    for(int i = 0; i < 3; i++)
+    {
+        push(&queue, &task[i]);
+    }
+
+    ASSERT_EQUAL(3, queue_size(&queue));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(peek(&queue) == &task[i]);
+        pop(&queue);
+    }
+
+    ASSERT_EQUAL(0, queue_size(&queue));
+    ASSERT_NULL(peek(&queue));
+
+    empty_queue(&queue);
+    ASSERT_NULL(queue);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the node pool reuses
+///         freed nodes and carves new ones out of
+///         a single chunk
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(queue, nodePool_process)
+{
+    struct task_t task[4];
+    struct node_pool_t pool;
+
+    pool_init(&pool, 4);
+
+    struct node_t* first = pool_alloc(&pool, &task[0]);
+    struct node_t* second = pool_alloc(&pool, &task[1]);
+
+    // Nodes come out of the chunk back to back
+    ASSERT_TRUE(second == first + 1);
+    ASSERT_TRUE(second->task == &task[1]);
+
+    // A freed node is handed out again before the
+    // chunk is touched
+    pool_free(&pool, first);
+    ASSERT_TRUE(pool_alloc(&pool, &task[2]) == first);
+    ASSERT_TRUE(first->task == &task[2]);
+
+    // Outstanding nodes are released along with
+    // the pool
+    pool_release(&pool);
+    ASSERT_NULL(pool.chunks);
+}
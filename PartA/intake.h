@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "fcfs.h"
+
+#ifndef __INTAKE__
+#define __INTAKE__
+
+// Size of a cache line, kept between the ends of the intake so producers and the scheduler don't
+// write to the same line
+#define INTAKE_CACHE_LINE 64
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Link of the intake queue, provided by the producer along with its task
+///
+/// @note The node must stay valid, and mustn't be pushed again, until the scheduler has taken its
+///       task (in practice, until the scheduler returns)
+//----------------------------------------------------------------------------------------------------------------------------------
+struct intake_node_t {
+
+    // Node pushed after this one, NULL for the last
+    struct intake_node_t* next;
+
+    // Task carried by the node
+    struct task_t* task;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Lock-free multi-producer single-consumer queue through which tasks are handed to a
+/// scheduler while it runs
+///
+/// @note This is Vyukov's intrusive MPSC queue. A push is one atomic exchange of the head and one
+///       store to the previous node, so producers never wait on each other or on the scheduler and
+///       a push never allocates; a pop touches only the consumer's end. A pop can miss a node whose
+///       producer is between those two steps; the node is then taken by a later pop.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct intake_queue_t {
+
+    // Node pushed last, swapped by every producer
+    struct intake_node_t* head __attribute__((aligned(INTAKE_CACHE_LINE)));
+
+    // Set once every producer is done pushing
+    int closed;
+
+    // Node to pop next, only touched by the scheduler
+    struct intake_node_t* tail __attribute__((aligned(INTAKE_CACHE_LINE)));
+
+    // Placeholder node, so the queue is never without one
+    struct intake_node_t stub;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty, open intake queue
+///
+/// @param[out] intake The queue
+//----------------------------------------------------------------------------------------------------------------------------------
+void intake_init(struct intake_queue_t *intake);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Hand a task to the scheduler; safe to call from any number of threads at once
+///
+/// @param[in] intake The queue
+/// @param[in] node Storage for the link, owned by the caller (see intake_node_t)
+/// @param[in] task The task
+//----------------------------------------------------------------------------------------------------------------------------------
+void intake_push(struct intake_queue_t *intake, struct intake_node_t *node, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Take the oldest task pushed; only the scheduler's thread may call this
+///
+/// @param[in] intake The queue
+///
+/// @return the task, NULL if none is ready to be taken
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* intake_pop(struct intake_queue_t *intake);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Tell the scheduler no more tasks will come, so it can return once it has run out of them
+///
+/// @note Call this only after every intake_push() has returned, e.g. after joining the producers
+///
+/// @param[in] intake The queue
+//----------------------------------------------------------------------------------------------------------------------------------
+void intake_close(struct intake_queue_t *intake);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Check whether the queue was closed
+///
+/// @note Once this returns 1, an intake_pop() which returns NULL means no task is left
+///
+/// @param[in] intake The queue
+///
+/// @return 1 if closed, 0 otherwise
+//----------------------------------------------------------------------------------------------------------------------------------
+int intake_is_closed(struct intake_queue_t *intake);
+
+#endif // __INTAKE__
@@ -1,6 +1,10 @@
 #include "queue.h"
 
 
+#define POOL_CHUNK_SIZE 1024
+
+
+static struct node_t* createQueueHandle(int capacity);
 static int isInvalidNode(struct node_t* node, const char* caller);
 
 
@@ -23,14 +27,17 @@ struct node_t* create_queue(struct task_t* task, int size)
         return NULL;
     }
 
-    // Create the sentinel node at the base of the queue
-    struct node_t* sentinel = create_new_node(NULL);
+    // Create the queue handle, which holds the sentinel
+    // NOTE: Size the first chunk of the node pool so
+    //       every task node is contiguous
+    struct node_t* sentinel = createQueueHandle(size);
 
     // Verify that malloc didn't fail
     if(isInvalidNode(sentinel, __func__))
     {
         return NULL;
     }
+
     // Create and link nodes together to form the queue
     // NOTE: The first "true" node in the queue is linked to the sentinel
     for(int i = 0; i < size; i++)
@@ -42,6 +49,47 @@ struct node_t* create_queue(struct task_t* task, int size)
 }
 
 
+///-------------------------------------------------
+/// @brief  Construct a queue handle with no task
+///         nodes
+///
+/// @return The sentinel node of the queue
+///-------------------------------------------------
+struct node_t* create_empty_queue(void)
+{
+    return createQueueHandle(POOL_CHUNK_SIZE);
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the handle that owns a queue
+///
+/// @param[in] head The head of the task queue
+///
+/// @return The queue handle
+///-------------------------------------------------
+struct queue_t* get_queue(struct node_t** head)
+{
+    // NOTE: The sentinel is the first member of
+    //       the handle, so they share an address
+    return (struct queue_t*)(*head);
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the number of task nodes in the
+///         queue
+///
+/// @param[in] head The head of the task queue
+///
+/// @return The number of task nodes
+///-------------------------------------------------
+int queue_size(struct node_t** head)
+{
+    return get_queue(head)->size;
+}
+
+
 ///-------------------------------------------------
 /// @brief  Construct a new task node
 ///
@@ -53,7 +101,7 @@ struct node_t* create_new_node(struct task_t* task)
 {
     // Dynamically allocate memory for the new node
     struct node_t* newNode = (struct node_t*)malloc(sizeof(struct node_t));
-    
+
     // Verify that malloc didn't fail
     if(isInvalidNode(newNode, __func__))
     {
@@ -68,11 +116,120 @@ struct node_t* create_new_node(struct task_t* task)
 }
 
 
+///-------------------------------------------------
+/// @brief  Initialize a node pool without
+///         allocating any chunk yet
+///
+/// @param[in] pool The pool to initialize
+/// @param[in] chunk_size Nodes in the first chunk
+///-------------------------------------------------
+void pool_init(struct node_pool_t* pool, int chunk_size)
+{
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->used = 0;
+    pool->chunk_size = (chunk_size > 0) ? chunk_size : POOL_CHUNK_SIZE;
+}
+
+
+///-------------------------------------------------
+/// @brief  Take a node from the pool, preferring
+///         previously freed nodes
+///
+/// @param[in] pool The pool
+/// @param[in] task Task to attach to the node
+///
+/// @return The node, NULL if malloc failed
+///-------------------------------------------------
+struct node_t* pool_alloc(struct node_pool_t* pool, struct task_t* task)
+{
+    struct node_t* newNode = pool->free_list;
+
+    if(newNode != NULL)
+    {
+        // Reuse a freed node
+        pool->free_list = newNode->next;
+    }
+    else
+    {
+        // Allocate a new chunk once the newest one is
+        // used up
+        if((pool->chunks == NULL) || (pool->used == pool->chunks->capacity))
+        {
+            struct node_chunk_t* chunk = (struct node_chunk_t*)malloc(sizeof(struct node_chunk_t) +
+                                                                      (pool->chunk_size * sizeof(struct node_t)));
+
+            if(chunk == NULL)
+            {
+                fprintf(stderr, "%s() ERROR: Couldn't create chunk!\n", __func__);
+                return NULL;
+            }
+
+            chunk->capacity = pool->chunk_size;
+            chunk->next = pool->chunks;
+            pool->chunks = chunk;
+            pool->used = 0;
+
+            // NOTE: Only the first chunk is sized by the
+            //       caller; the rest cover requeues
+            pool->chunk_size = POOL_CHUNK_SIZE;
+        }
+
+        // Carve the next node out of the newest chunk
+        newNode = &(pool->chunks->nodes[pool->used]);
+        pool->used++;
+    }
+
+    // Initialize node data members
+    newNode->task = task;
+    newNode->next = NULL;
+
+    return newNode;
+}
+
+
+///-------------------------------------------------
+/// @brief  Give a node back to the pool
+///
+/// @param[in] pool The pool the node came from
+/// @param[in] node The node to reuse later
+///-------------------------------------------------
+void pool_free(struct node_pool_t* pool, struct node_t* node)
+{
+    node->task = NULL;
+    node->next = pool->free_list;
+    pool->free_list = node;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free every chunk of the pool at once
+///
+/// @param[in] pool The pool to release
+///-------------------------------------------------
+void pool_release(struct node_pool_t* pool)
+{
+    struct node_chunk_t* chunk = pool->chunks;
+    struct node_chunk_t* nextChunk;
+
+    while(chunk != NULL)
+    {
+        nextChunk = chunk->next;
+        free(chunk);
+        chunk = nextChunk;
+    }
+
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->used = 0;
+}
+
+
 ///-------------------------------------------------
 /// @brief Returns the top-most task for the queue
 ///
 /// @param[in] head The head of the task queue
-/// 
+///
 /// @return The top-most task
 ///-------------------------------------------------
 struct task_t* peek(struct node_t** head)
@@ -99,18 +256,28 @@ struct task_t* peek(struct node_t** head)
 ///-------------------------------------------------
 void pop(struct node_t** head)
 {
-    // Check if the queue is empty
-    if(is_empty(head))
+    // Check if the queue is invalid or empty
+    if(isInvalidNode(*head, __func__) || is_empty(head))
     {
         return;
     }
 
-    // Pop the old head
-    struct node_t* oldHead = *head;
-    *head = (*head)->next;
+    struct queue_t* queue = get_queue(head);
+    struct node_t* nodeToPop = queue->sentinel.next;
 
-    // Free the memory allocated for the popped head
-    free(oldHead);
+    // Unlink the top-most task node from the sentinel
+    queue->sentinel.next = nodeToPop->next;
+    queue->size--;
+
+    // The queue is now empty, so the tail falls
+    // back to the sentinel
+    if(queue->sentinel.next == NULL)
+    {
+        queue->tail = &(queue->sentinel);
+    }
+
+    // Give the popped node back to the pool
+    pool_free(&(queue->pool), nodeToPop);
 }
 
 
@@ -122,38 +289,28 @@ void pop(struct node_t** head)
 ///-------------------------------------------------
 void push(struct node_t** head, struct task_t* task)
 {
-    #ifndef DEBUG
     // Verify that the queue is initialized properly
     if(isInvalidNode(*head, __func__) || (task == NULL))
     {
         return;
     }
 
-    struct node_t* sentinel = *head;
+    struct queue_t* queue = get_queue(head);
+    struct node_t* newNode = pool_alloc(&(queue->pool), task);
 
-    // Check if the queue is empty
-    if(is_empty(&sentinel))
+    // Verify that malloc didn't fail
+    if(isInvalidNode(newNode, __func__))
     {
-        // Link the new node to the sentinel
-        sentinel->next = create_new_node(task);
+        return;
     }
-    else
-    {
-        struct node_t* nextNode = sentinel->next;
-        struct node_t* currentNode;
-
-        // Traverse queue until you find the sentinel
-        while(nextNode != NULL)
-        {
-            currentNode = nextNode;
-            nextNode = nextNode->next;
-        }
 
-        // Insert new node at the end of the task queue
-        struct node_t* newNode = create_new_node(task);
-        currentNode->next = newNode;
-    }
-    #endif
+    // Insert new node at the end of the task queue
+    // NOTE: When the queue is empty the tail is the
+    //       sentinel, so this also links the first
+    //       task node to the sentinel
+    queue->tail->next = newNode;
+    queue->tail = newNode;
+    queue->size++;
 }
 
 
@@ -171,31 +328,57 @@ int is_empty(struct node_t** head)
 
 
 ///-------------------------------------------------
-/// @brief  Traverse the queue and free all memory
-///         aside from the the sentinel
+/// @brief  Free all memory held by the queue,
+///         including the queue handle
 ///
 /// @param[in] head The head of the queue to empty
 ///-------------------------------------------------
 void empty_queue(struct node_t** head)
 {
-    // Check if queue is empty or uninitialized
-    if(is_empty(head))
+    // Check if queue is uninitialized
+    if(*head == NULL)
     {
         return;
     }
 
-    struct node_t* currentNode = *head;
-    struct node_t* nextNode;
+    // Free every task node at once
+    pool_release(&(get_queue(head)->pool));
 
-    // Traverse the queue and free each node
-    while(currentNode != NULL)
+    // Free the handle, which holds the sentinel
+    free(get_queue(head));
+
+    *head = NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Construct a queue handle with an empty
+///         node pool
+///
+/// @param[in] capacity Number of nodes in the
+///                     first chunk of the pool
+///
+/// @return The sentinel node of the queue
+///-------------------------------------------------
+static struct node_t* createQueueHandle(int capacity)
+{
+    // Dynamically allocate memory for the handle
+    struct queue_t* queue = (struct queue_t*)malloc(sizeof(struct queue_t));
+
+    if(queue == NULL)
     {
-        nextNode = currentNode->next;
-        free(currentNode);
-        currentNode = nextNode;
+        fprintf(stderr, "%s() ERROR: Couldn't create queue!\n", __func__);
+        return NULL;
     }
 
-    *head = NULL;
+    // An empty queue's tail is its sentinel
+    queue->sentinel.task = NULL;
+    queue->sentinel.next = NULL;
+    queue->tail = &(queue->sentinel);
+    queue->size = 0;
+    pool_init(&(queue->pool), capacity);
+
+    return &(queue->sentinel);
 }
 
 
@@ -216,4 +399,4 @@ static int isInvalidNode(struct node_t* node, const char* caller)
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,97 @@
+#include "sjf.h"
+#include "events.h"
+#include "taskheap.h"
+
+
+// Kinds of event of the scheduler
+#define EVENT_ARRIVAL 0
+#define EVENT_COMPLETION 1
+
+
+///-------------------------------------------------
+/// @brief  Shortest Job First scheduler driven by
+///         arrival and completion events
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] trace Sink for the times, or NULL
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int shortest_job_first(struct task_t* task, int size, struct trace_sink_t* trace)
+{
+    struct event_queue_t events;
+    struct task_heap_t ready;
+    struct task_t* running = NULL;
+    struct event_t event;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    // Every arrival plus the one completion pending
+    // at any time; every task is ready at most once
+    if(event_queue_init(&events, size + 1))
+    {
+        return 1;
+    }
+
+    if(task_heap_init(&ready, size))
+    {
+        event_queue_free(&events);
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; i < size; i++)
+    {
+        event_push(&events, task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    while(!event_queue_is_empty(&events))
+    {
+        event_pop(&events, &event);
+
+        if(event.kind == EVENT_ARRIVAL)
+        {
+            task_heap_push(&ready, &(task[event.index]));
+        }
+        else
+        {
+            run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+            trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+            running = NULL;
+        }
+
+        // "Execute" the shortest ready task once the CPU
+        // is free; its times are known from the start
+        // NOTE: Only pick once every event at this time
+        //       is handled, so each task arriving now is
+        //       a candidate
+        const struct event_t* next = event_peek(&events);
+
+        if((running == NULL) && !task_heap_is_empty(&ready) && ((next == NULL) || (next->time != event.time)))
+        {
+            running = task_heap_pop(&ready);
+
+            running->waiting_time = (int)(event.time - running->arrival_time);
+            running->turnaround_time = running->waiting_time + running->execution_time;
+
+            if(event_push(&events, event.time + running->execution_time, EVENT_COMPLETION, (int)(running - task)))
+            {
+                status = 1;
+                break;
+            }
+        }
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    // Cleanup
+    task_heap_free(&ready);
+    event_queue_free(&events);
+
+    return status;
+}
@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "fcfs.h"
+
+#ifndef __SHORTEST_JOB_FIRST__
+#define __SHORTEST_JOB_FIRST__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the non-preemptive shortest job first algorithm and calculate the wait and turn
+/// around time for each task, emitting the times of each task to a trace sink when it ends
+///
+/// @note Whenever the CPU frees up, the shortest task which has arrived runs to completion; tasks
+///       of the same length run in array order. The ready tasks are kept in a d-ary heap (see
+///       taskheap.h) and arrivals and completions in an event queue (see events.h), so each
+///       decision costs O(log n) and idle gaps cost nothing. Wait and turn around times are
+///       measured from the arrival time. When every task arrives at the same time this gives the
+///       smallest average wait time any schedule can.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int shortest_job_first(struct task_t *task, int size, struct trace_sink_t *trace);
+
+#endif // __SHORTEST_JOB_FIRST__
@@ -0,0 +1,293 @@
+#include "taskset.h"
+#include <limits.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+#define TASK_SET_FIELDS 4
+
+
+static float averageOf(int* values, int size);
+static int* mappedColumn(const struct column_file_t* file, enum column_id_t id);
+
+
+///-------------------------------------------------
+/// @brief  Allocate every array of the task set
+///         in one block
+///
+/// @param[out] set The task set
+/// @param[in] size The number of tasks
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int task_set_create(struct task_set_t* set, int size)
+{
+    int entries = (size > 0) ? size : 0;
+
+    // NOTE: One spare entry keeps an empty set from
+    //       asking malloc for 0 bytes
+    int* storage = (int*)malloc(((size_t)TASK_SET_FIELDS * entries + 1) * sizeof(int));
+
+    if(storage == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create task set!\n", __func__);
+        set->size = 0;
+        set->storage = NULL;
+        return 1;
+    }
+
+    set->size = entries;
+    set->process_id = storage;
+    set->execution_time = storage + entries;
+    set->waiting_time = storage + (2 * entries);
+    set->turnaround_time = storage + (3 * entries);
+    set->storage = storage;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the block backing the task set
+///
+/// @param[in] set The task set
+///-------------------------------------------------
+void task_set_free(struct task_set_t* set)
+{
+    free(set->storage);
+
+    set->size = 0;
+    set->storage = NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Borrow the columns of a workload and a
+///         results file for the task set
+///
+/// @param[out] set The task set
+/// @param[in] workload The mapped workload
+/// @param[in] results The mapped results
+///
+/// @return 1: Missing column or allocation failed;
+///         0: Success
+///-------------------------------------------------
+int task_set_map(struct task_set_t* set, const struct column_file_t* workload, struct column_file_t* results)
+{
+    int* processId = mappedColumn(workload, COLUMN_PROCESS_ID);
+    int* execution = mappedColumn(workload, COLUMN_EXECUTION_TIME);
+    int* waiting = results->writable ? mappedColumn(results, COLUMN_WAITING_TIME) : NULL;
+    int* turnaround = results->writable ? mappedColumn(results, COLUMN_TURNAROUND_TIME) : NULL;
+
+    set->size = 0;
+    set->storage = NULL;
+
+    if((execution == NULL) || (waiting == NULL) || (turnaround == NULL) ||
+       (workload->rows != results->rows) || (workload->rows > INT_MAX))
+    {
+        fprintf(stderr, "%s() ERROR: Files don't hold matching int32 columns!\n", __func__);
+        return 1;
+    }
+
+    // Arrays no file provides are owned by the set
+    size_t entries = (size_t)workload->rows;
+    int owned = (processId == NULL);
+
+    int* storage = NULL;
+
+    if(owned > 0)
+    {
+        storage = (int*)malloc((owned * entries + 1) * sizeof(int));
+
+        if(storage == NULL)
+        {
+            fprintf(stderr, "%s() ERROR: Couldn't create task set!\n", __func__);
+            return 1;
+        }
+
+        processId = storage;
+
+        for(size_t i = 0; i < entries; i++)
+        {
+            processId[i] = (int)i;
+        }
+    }
+
+    set->size = (int)entries;
+    set->process_id = processId;
+    set->execution_time = execution;
+    set->waiting_time = waiting;
+    set->turnaround_time = turnaround;
+    set->storage = storage;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Initialize the task set
+///
+/// @param[in] set The task set
+/// @param[in] execution Array containing the
+///                      execution times of each
+///                      task
+///-------------------------------------------------
+void task_set_init(struct task_set_t* set, int* execution)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        set->process_id[i] = i;
+        set->execution_time[i] = execution[i];
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Scatter a task array into the arrays of
+///         the task set
+///
+/// @param[in] set The task set
+/// @param[in] task The task array
+///-------------------------------------------------
+void task_set_from_tasks(struct task_set_t* set, struct task_t* task)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        set->process_id[i] = task[i].process_id;
+        set->execution_time[i] = task[i].execution_time;
+        set->waiting_time[i] = task[i].waiting_time;
+        set->turnaround_time[i] = task[i].turnaround_time;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Gather the arrays of the task set into
+///         a task array
+///
+/// @param[in] set The task set
+/// @param[out] task The task array
+///-------------------------------------------------
+void task_set_to_tasks(struct task_set_t* set, struct task_t* task)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        task[i].process_id = set->process_id[i];
+        task[i].execution_time = set->execution_time[i];
+        task[i].waiting_time = set->waiting_time[i];
+        task[i].turnaround_time = set->turnaround_time[i];
+        task[i].arrival_time = 0;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  First Come First Served scheduler as a
+///         prefix sum over the execution times
+///
+/// @param[in] set The task set
+///-------------------------------------------------
+void task_set_first_come_first_served(struct task_set_t* set)
+{
+    int* execution = set->execution_time;
+    int runTime = 0;
+    int i = 0;
+
+#ifdef __SSE2__
+    __m128i carry = _mm_setzero_si128();
+
+    // Scan four contiguous execution times at a time
+    for(; (i + 4) <= set->size; i += 4)
+    {
+        __m128i burst = _mm_loadu_si128((__m128i*)&(execution[i]));
+
+        __m128i sum = _mm_add_epi32(burst, _mm_slli_si128(burst, 4));
+        sum = _mm_add_epi32(sum, _mm_slli_si128(sum, 8));
+
+        __m128i turnaround = _mm_add_epi32(sum, carry);
+
+        _mm_storeu_si128((__m128i*)&(set->turnaround_time[i]), turnaround);
+        _mm_storeu_si128((__m128i*)&(set->waiting_time[i]), _mm_sub_epi32(turnaround, burst));
+
+        // The last task's turnaround starts the next block
+        carry = _mm_shuffle_epi32(turnaround, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    runTime = _mm_cvtsi128_si32(carry);
+#endif
+
+    for(; i < set->size; i++)
+    {
+        set->waiting_time[i] = runTime;
+        runTime += execution[i];
+        set->turnaround_time[i] = runTime;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Calculate the average wait time of
+///         the tasks in the set
+///
+/// @param[in] set The task set
+///
+/// @return Average wait time of all tasks
+///-------------------------------------------------
+float task_set_average_wait_time(struct task_set_t* set)
+{
+    return averageOf(set->waiting_time, set->size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Calculate the average turnaround time of
+///         the tasks in the set
+///
+/// @param[in] set The task set
+///
+/// @return Average turnaround time of all tasks
+///-------------------------------------------------
+float task_set_average_turn_around_time(struct task_set_t* set)
+{
+    return averageOf(set->turnaround_time, set->size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Average one contiguous array
+///
+/// @param[in] values The array
+/// @param[in] size Number of entries
+///
+/// @return The average of the entries
+///-------------------------------------------------
+static float averageOf(int* values, int size)
+{
+    long long totalTime = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        totalTime += values[i];
+    }
+
+    return (float)((double)totalTime / size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Find an int32 column of a file
+///
+/// @param[in] file The column file
+/// @param[in] id The column to find
+///
+/// @return The column; NULL: Missing or int64
+///-------------------------------------------------
+static int* mappedColumn(const struct column_file_t* file, enum column_id_t id)
+{
+    int width = 0;
+    int* column = (int*)column_file_column(file, id, &width);
+
+    return (width == sizeof(int)) ? column : NULL;
+}
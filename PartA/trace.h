@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "metrics.h"
+
+#ifndef __TRACE__
+#define __TRACE__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Formats a trace sink can write
+//----------------------------------------------------------------------------------------------------------------------------------
+enum trace_mode_t {
+    // Drop every event without formatting it
+    TRACE_NONE,
+
+    // Human readable wait and turn around times, buffered before they reach the stream
+    TRACE_TEXT,
+
+    // Fixed size trace_event_t records in host byte order
+    TRACE_BINARY
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Record written by a TRACE_BINARY sink each time a task runs
+//----------------------------------------------------------------------------------------------------------------------------------
+struct trace_event_t {
+
+    // Process number of the task which ran
+    int process_id;
+
+    // Wait time of the task after it ran
+    int waiting_time;
+
+    // Turn around time of the task after it ran
+    int turnaround_time;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which receives the events emitted by a scheduler
+//----------------------------------------------------------------------------------------------------------------------------------
+struct trace_sink_t {
+
+    // Format of the trace
+    enum trace_mode_t mode;
+
+    // Stream the trace is written to
+    FILE* stream;
+
+    // Events waiting to be written to the stream
+    char* buffer;
+
+    // Size of the buffer in bytes
+    size_t capacity;
+
+    // Number of bytes of the buffer in use
+    size_t used;
+
+    // Number of events emitted so far
+    long long events;
+
+    // Times of every task finished by the runs emitted to the sink, kept in any mode
+    struct run_metrics_t metrics;
+
+    // Distribution of those wait times, kept only after trace_keep_histograms()
+    struct histogram_t wait_histogram;
+
+    // Distribution of those turn around times, kept only after trace_keep_histograms()
+    struct histogram_t turnaround_histogram;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Open a trace sink
+///
+/// @param[out] sink The sink
+/// @param[in] mode The format of the trace
+/// @param[in] stream Where to write the trace; ignored for TRACE_NONE
+///
+/// @return 0 on success, 1 if the buffer couldn't be allocated or the stream is missing
+//----------------------------------------------------------------------------------------------------------------------------------
+int trace_open(struct trace_sink_t* sink, enum trace_mode_t mode, FILE* stream);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Keep histograms of the wait and turn around times of every task finished from now on, in
+/// any mode, so their percentiles can be read until the sink is closed
+///
+/// @param[in] sink The sink
+///
+/// @return 0 on success, 1 if the histograms couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int trace_keep_histograms(struct trace_sink_t* sink);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Determines whether a sink writes anything
+///
+/// @param[in] sink The sink, may be NULL
+///
+/// @return True if events emitted to the sink are recorded, False otherwise
+//----------------------------------------------------------------------------------------------------------------------------------
+int trace_enabled(const struct trace_sink_t* sink);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Emit the times of a task which just ran
+///
+/// @param[in] sink The sink, may be NULL
+/// @param[in] process_id Process number of the task
+/// @param[in] waiting_time Wait time of the task
+/// @param[in] turnaround_time Turn around time of the task
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_event(struct trace_sink_t* sink, int process_id, int waiting_time, int turnaround_time);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Emit the averages of a finished run (only TRACE_TEXT writes them)
+///
+/// @param[in] sink The sink, may be NULL
+/// @param[in] average_wait The average wait time
+/// @param[in] average_turnaround The average turn around time
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_summary(struct trace_sink_t* sink, float average_wait, float average_turnaround);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Start a run: empty the metrics a scheduler records the tasks it finishes in, and point
+/// them at the histograms of the sink if it keeps any
+///
+/// @param[in] sink The sink, may be NULL
+/// @param[out] metrics The metrics of the run
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_begin(struct trace_sink_t* sink, struct run_metrics_t* metrics);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief End a run: add the times of the tasks it finished to the metrics of the sink and emit
+/// their averages, without another pass over the tasks
+///
+/// @param[in] sink The sink, may be NULL
+/// @param[in] metrics The times of the tasks the run finished
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_finish(struct trace_sink_t* sink, const struct run_metrics_t* metrics);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Write every buffered event to the stream
+///
+/// @param[in] sink The sink, may be NULL
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_flush(struct trace_sink_t* sink);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Flush the sink and release its buffer and histograms. The stream is left open.
+///
+/// @param[in] sink The sink, may be NULL
+//----------------------------------------------------------------------------------------------------------------------------------
+void trace_close(struct trace_sink_t* sink);
+
+#endif // __TRACE__
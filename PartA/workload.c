@@ -0,0 +1,264 @@
+#include "workload.h"
+#include <ctype.h>
+
+
+// Longest CSV line the reader accepts
+#define WORKLOAD_LINE_SIZE 256
+
+// Binary records are read this many at a time
+#define WORKLOAD_RECORD_CHUNK 256
+
+
+static int readCSV(struct workload_reader_t* reader, struct task_t* task, int capacity);
+static int readBinary(struct workload_reader_t* reader, struct task_t* task, int capacity);
+static void fillTask(struct workload_reader_t* reader, struct task_t* task, int index, const int* fields, int count);
+
+
+///-------------------------------------------------
+/// @brief  Open a workload file for reading
+///
+/// @param[out] reader The reader
+/// @param[in] path Path of the file
+/// @param[in] format Format of the file
+///
+/// @return 1: Couldn't open; 0: Success
+///-------------------------------------------------
+int workload_open(struct workload_reader_t* reader, const char* path, enum workload_format_t format)
+{
+    FILE* stream = fopen(path, (format == WORKLOAD_BINARY) ? "rb" : "r");
+
+    if(stream == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't open %s!\n", __func__, path);
+        return 1;
+    }
+
+    workload_attach(reader, stream, format);
+    reader->owns_stream = 1;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Read a workload from an open stream
+///
+/// @param[out] reader The reader
+/// @param[in] stream The stream
+/// @param[in] format Format of the stream
+///-------------------------------------------------
+void workload_attach(struct workload_reader_t* reader, FILE* stream, enum workload_format_t format)
+{
+    reader->format = format;
+    reader->stream = stream;
+    reader->owns_stream = 0;
+    reader->tasks_read = 0;
+    reader->line = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Read up to capacity tasks
+///
+/// @param[in] reader The reader
+/// @param[out] task The task buffer
+/// @param[in] capacity Size of the buffer
+///
+/// @return Tasks read; 0: End of file; -1: Error
+///-------------------------------------------------
+int workload_read(struct workload_reader_t* reader, struct task_t* task, int capacity)
+{
+    if((reader->stream == NULL) || (capacity < 1))
+    {
+        return 0;
+    }
+
+    if(reader->format == WORKLOAD_BINARY)
+    {
+        return readBinary(reader, task, capacity);
+    }
+
+    return readCSV(reader, task, capacity);
+}
+
+
+///-------------------------------------------------
+/// @brief  Close the reader and, if it opened it,
+///         its file
+///
+/// @param[in] reader The reader
+///-------------------------------------------------
+void workload_close(struct workload_reader_t* reader)
+{
+    if(reader->owns_stream && (reader->stream != NULL))
+    {
+        fclose(reader->stream);
+    }
+
+    reader->stream = NULL;
+    reader->owns_stream = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Parse CSV lines into tasks
+///
+/// @param[in] reader The reader
+/// @param[out] task The task buffer
+/// @param[in] capacity Size of the buffer
+///
+/// @return Tasks read; 0: End of file; -1: Error
+///-------------------------------------------------
+static int readCSV(struct workload_reader_t* reader, struct task_t* task, int capacity)
+{
+    char line[WORKLOAD_LINE_SIZE];
+    int count = 0;
+
+    while((count < capacity) && (fgets(line, sizeof(line), reader->stream) != NULL))
+    {
+        char* cursor = line;
+        int fields[3];
+        int fieldCount = 0;
+
+        reader->line++;
+
+        while(isspace((unsigned char)*cursor))
+        {
+            cursor++;
+        }
+
+        // Skip blank lines and comments
+        if((*cursor == '\0') || (*cursor == '#'))
+        {
+            continue;
+        }
+
+        // Skip a header naming the columns
+        if((reader->tasks_read == 0) && (count == 0) && !isdigit((unsigned char)*cursor) && (*cursor != '-') && (*cursor != '+'))
+        {
+            continue;
+        }
+
+        // Parse up to three comma separated integers
+        while(fieldCount < 3)
+        {
+            char* end;
+            long value = strtol(cursor, &end, 10);
+
+            if(end == cursor)
+            {
+                break;
+            }
+
+            fields[fieldCount++] = (int)value;
+            cursor = end;
+
+            while((*cursor == ' ') || (*cursor == '\t'))
+            {
+                cursor++;
+            }
+
+            if(*cursor != ',')
+            {
+                break;
+            }
+
+            cursor++;
+        }
+
+        while(isspace((unsigned char)*cursor))
+        {
+            cursor++;
+        }
+
+        if((fieldCount == 0) || (*cursor != '\0'))
+        {
+            fprintf(stderr, "%s() ERROR: Malformed task on line %lld!\n", __func__, reader->line);
+            return -1;
+        }
+
+        fillTask(reader, task, count, fields, fieldCount);
+        count++;
+    }
+
+    return count;
+}
+
+
+///-------------------------------------------------
+/// @brief  Read binary records into tasks
+///
+/// @param[in] reader The reader
+/// @param[out] task The task buffer
+/// @param[in] capacity Size of the buffer
+///
+/// @return Tasks read; 0: End of file; -1: Error
+///-------------------------------------------------
+static int readBinary(struct workload_reader_t* reader, struct task_t* task, int capacity)
+{
+    struct workload_record_t records[WORKLOAD_RECORD_CHUNK];
+    int count = 0;
+
+    while(count < capacity)
+    {
+        int wanted = capacity - count;
+
+        if(wanted > WORKLOAD_RECORD_CHUNK)
+        {
+            wanted = WORKLOAD_RECORD_CHUNK;
+        }
+
+        size_t bytes = fread(records, 1, wanted * sizeof(struct workload_record_t), reader->stream);
+        int got = (int)(bytes / sizeof(struct workload_record_t));
+
+        // A file must hold whole records only
+        if((bytes % sizeof(struct workload_record_t)) != 0)
+        {
+            fprintf(stderr, "%s() ERROR: Truncated task %lld!\n", __func__, reader->tasks_read + got);
+            return -1;
+        }
+
+        for(int i = 0; i < got; i++)
+        {
+            int fields[3] = {records[i].process_id, records[i].execution_time, records[i].arrival_time};
+
+            fillTask(reader, task, count, fields, 3);
+            count++;
+        }
+
+        if(got < wanted)
+        {
+            if(ferror(reader->stream))
+            {
+                fprintf(stderr, "%s() ERROR: Couldn't read task %lld!\n", __func__, reader->tasks_read);
+                return -1;
+            }
+
+            break;
+        }
+    }
+
+    return count;
+}
+
+
+///-------------------------------------------------
+/// @brief  Initialize one task from parsed fields
+///
+/// @param[in] reader The reader
+/// @param[out] task The task buffer
+/// @param[in] index Entry of the buffer to fill
+/// @param[in] fields "burst", "id,burst" or
+///                   "id,burst,arrival"
+/// @param[in] count Number of fields
+///-------------------------------------------------
+static void fillTask(struct workload_reader_t* reader, struct task_t* task, int index, const int* fields, int count)
+{
+    task[index].process_id = (count > 1) ? fields[0] : (int)reader->tasks_read;
+    task[index].execution_time = (count > 1) ? fields[1] : fields[0];
+    task[index].waiting_time = 0;
+    task[index].turnaround_time = 0;
+    task[index].arrival_time = (count > 2) ? fields[2] : 0;
+
+    reader->tasks_read++;
+}
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "fcfs.h"
+
+#ifndef __WORKLOAD__
+#define __WORKLOAD__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Formats a workload file can be stored in
+//----------------------------------------------------------------------------------------------------------------------------------
+enum workload_format_t {
+    // One task per line as "burst", "id,burst" or "id,burst,arrival". Blank lines, lines starting
+    // with '#' and a leading header line are skipped.
+    WORKLOAD_CSV,
+
+    // Back to back workload_record_t records in host byte order, with no header
+    WORKLOAD_BINARY
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Record of a WORKLOAD_BINARY file
+//----------------------------------------------------------------------------------------------------------------------------------
+struct workload_record_t {
+
+    // Process number of the task
+    int process_id;
+
+    // Amount of time the task takes to execute
+    int execution_time;
+
+    // Time at which the task arrives
+    int arrival_time;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which reads the tasks of a workload file a chunk at a time
+//----------------------------------------------------------------------------------------------------------------------------------
+struct workload_reader_t {
+
+    // Format of the file
+    enum workload_format_t format;
+
+    // Stream the tasks are read from
+    FILE* stream;
+
+    // Close the stream in workload_close()
+    int owns_stream;
+
+    // Number of tasks read so far
+    long long tasks_read;
+
+    // Number of lines read so far (WORKLOAD_CSV)
+    long long line;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Open a workload file
+///
+/// @param[out] reader The reader
+/// @param[in] path Path of the file
+/// @param[in] format Format of the file
+///
+/// @return 0 on success, 1 if the file couldn't be opened
+//----------------------------------------------------------------------------------------------------------------------------------
+int workload_open(struct workload_reader_t* reader, const char* path, enum workload_format_t format);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Read a workload from an already open stream, which workload_close() leaves open
+///
+/// @param[out] reader The reader
+/// @param[in] stream The stream
+/// @param[in] format Format of the stream
+//----------------------------------------------------------------------------------------------------------------------------------
+void workload_attach(struct workload_reader_t* reader, FILE* stream, enum workload_format_t format);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Read the next chunk of tasks, the same way init() initializes a task array
+///
+/// @note A task without an id gets its position in the file; a task without an arrival time
+///       arrives at time 0
+///
+/// @param[in] reader The reader
+/// @param[out] task The buffer receiving task data
+/// @param[in] capacity The size of the buffer
+///
+/// @return the number of tasks read, 0 at the end of the file, -1 if the file is malformed
+//----------------------------------------------------------------------------------------------------------------------------------
+int workload_read(struct workload_reader_t* reader, struct task_t* task, int capacity);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Close the reader
+///
+/// @param[in] reader The reader
+//----------------------------------------------------------------------------------------------------------------------------------
+void workload_close(struct workload_reader_t* reader);
+
+#endif // __WORKLOAD__
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "rr.h"
+#include "rr_analytic.h"
+#include "taskset.h"
+#include "srtf.h"
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @Benchmark
+/// Runs each Round Robin engine over task counts from 10 up to the given maximum, several quanta
+/// and several burst distributions, and Shortest Remaining Time First once per workload for
+/// comparison (with quantum 0). Every run prints one CSV row to stdout:
+///
+///     engine,distribution,tasks,quantum,runs,seconds,tasks_per_sec,slices_per_sec,ns_per_queue_op,peak_rss_kb,average_wait
+///
+/// seconds is the mean over all runs; ns_per_queue_op is 0 for engines which don't use a ready
+/// queue and peak_rss_kb is the peak resident set of the whole process so far. Simulating engines
+/// are left out of workloads with more than max_slices slices. average_wait is the average wait
+/// time of the schedule, the smallest possible one for srtf.
+///
+/// @Usage
+/// ./rrbench [max_tasks] [max_slices]
+//----------------------------------------------------------------------------------------------------------------------------------
+
+
+#define DEFAULT_MAX_TASKS 10000000
+#define DEFAULT_MAX_SLICES 200000000LL
+
+// Small task counts are repeated until they have run for at least this long
+#define MIN_BENCH_SECONDS 0.02
+
+
+///-------------------------------------------------
+/// @brief  Burst length distributions to draw
+///         execution times from
+///-------------------------------------------------
+enum distribution_t {
+    UNIFORM,
+    CONSTANT,
+    EXPONENTIAL,
+    BIMODAL,
+    DISTRIBUTION_COUNT
+};
+
+
+///-------------------------------------------------
+/// @brief  Engines under test
+///-------------------------------------------------
+enum engine_t {
+    ENGINE_LINKED,
+    ENGINE_ROTATE,
+    ENGINE_RING,
+    ENGINE_RING_SKIP,
+    ENGINE_TASK_SET,
+    ENGINE_ANALYTIC,
+    ENGINE_SRTF,
+    ENGINE_COUNT
+};
+
+
+static const char* distributionNames[DISTRIBUTION_COUNT] = {"uniform", "constant", "exponential", "bimodal"};
+static const char* engineNames[ENGINE_COUNT] = {"rr_linked", "rr_rotate", "rr_ring", "rr_ring_skip", "rr_task_set", "rr_analytic", "srtf"};
+static const int quanta[] = {1, 4, 16, 64};
+
+
+static unsigned int nextRandom(unsigned int* seed);
+static void fillBursts(int* execution, int size, enum distribution_t distribution);
+static double now(void);
+static long peakRssKb(void);
+static long long countSlices(int* execution, int size, int quantum);
+static double runEngine(enum engine_t engine, struct task_t* task, struct task_set_t* set, int* execution, int size,
+                        int quantum, struct rr_stats_t* stats);
+static double averageWait(enum engine_t engine, struct task_t* task, struct task_set_t* set, int size);
+
+
+int main(int argc, const char* argv[])
+{
+    int maxTasks = DEFAULT_MAX_TASKS;
+    long long maxSlices = DEFAULT_MAX_SLICES;
+
+    if(argc > 1)
+    {
+        maxTasks = atoi(argv[1]);
+    }
+
+    if(argc > 2)
+    {
+        maxSlices = atoll(argv[2]);
+    }
+
+    if(maxTasks < 10)
+    {
+        fprintf(stderr, "usage: %s [max_tasks >= 10] [max_slices]\n", argv[0]);
+        return 1;
+    }
+
+    int* execution = (int*)malloc((size_t)maxTasks * sizeof(int));
+    struct task_t* task = (struct task_t*)malloc((size_t)maxTasks * sizeof(struct task_t));
+    struct task_set_t set;
+
+    if((execution == NULL) || (task == NULL) || task_set_create(&set, maxTasks))
+    {
+        fprintf(stderr, "%s: Couldn't allocate %d tasks!\n", argv[0], maxTasks);
+        return 1;
+    }
+
+    printf("engine,distribution,tasks,quantum,runs,seconds,tasks_per_sec,slices_per_sec,ns_per_queue_op,peak_rss_kb,average_wait\n");
+
+    for(int distribution = 0; distribution < DISTRIBUTION_COUNT; distribution++)
+    {
+        for(long long size = 10; size <= maxTasks; size *= 10)
+        {
+            fillBursts(execution, (int)size, (enum distribution_t)distribution);
+
+            for(int q = 0; q < (int)(sizeof(quanta) / sizeof(quanta[0])); q++)
+            {
+                long long slices = countSlices(execution, (int)size, quanta[q]);
+
+                for(int engine = 0; engine < ENGINE_COUNT; engine++)
+                {
+                    struct rr_stats_t stats = {0};
+                    int runs = 0;
+                    double elapsed = 0;
+
+                    // Only the analytic solver and SRTF don't
+                    // scale with the number of slices, and
+                    // SRTF has no quantum
+                    if((engine < ENGINE_ANALYTIC) && (slices > maxSlices))
+                    {
+                        continue;
+                    }
+
+                    if((engine == ENGINE_SRTF) && (q > 0))
+                    {
+                        continue;
+                    }
+
+                    // Repeat short runs so the timer resolution
+                    // doesn't dominate
+                    do
+                    {
+                        elapsed += runEngine((enum engine_t)engine, task, &set, execution, (int)size, quanta[q], &stats);
+                        runs++;
+                    } while(elapsed < MIN_BENCH_SECONDS);
+
+                    double seconds = elapsed / runs;
+
+                    // NOTE: Building the queue pushes every task,
+                    //       then each simulated slice peeks and
+                    //       either requeues or pops its task
+                    double queueOps = 0;
+
+                    if(engine <= ENGINE_RING_SKIP)
+                    {
+                        queueOps = size + (2.0 * (stats.slices - stats.skipped_slices));
+                    }
+
+                    long long ran = (engine == ENGINE_SRTF) ? stats.slices : slices;
+
+                    printf("%s,%s,%lld,%d,%d,%.9f,%.0f,%.0f,%.2f,%ld,%.3f\n",
+                           engineNames[engine], distributionNames[distribution], size,
+                           (engine == ENGINE_SRTF) ? 0 : quanta[q], runs, seconds, size / seconds, ran / seconds,
+                           (queueOps > 0) ? (seconds * 1e9 / queueOps) : 0, peakRssKb(),
+                           averageWait((enum engine_t)engine, task, &set, (int)size));
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    task_set_free(&set);
+    free(task);
+    free(execution);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Run one engine over freshly initialized
+///         tasks
+///
+/// @param[in] engine Engine to run
+/// @param[in] task Task array to schedule
+/// @param[in] set Task set to schedule
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] quantum Length of a time slice
+/// @param[out] stats Counters of the run
+///
+/// @return Seconds spent scheduling
+///-------------------------------------------------
+static double runEngine(enum engine_t engine, struct task_t* task, struct task_set_t* set, int* execution, int size,
+                        int quantum, struct rr_stats_t* stats)
+{
+    struct rr_config_t config = rr_default_config();
+    double start;
+
+    if(engine == ENGINE_TASK_SET)
+    {
+        set->size = size;
+        task_set_init(set, execution);
+
+        start = now();
+        task_set_round_robin(set, quantum);
+
+        return now() - start;
+    }
+
+    init(task, execution, size);
+
+    if(engine == ENGINE_ANALYTIC)
+    {
+        start = now();
+        round_robin_analytic(task, quantum, size);
+
+        return now() - start;
+    }
+
+    if(engine == ENGINE_SRTF)
+    {
+        start = now();
+        shortest_remaining_time_first(task, size, NULL, stats);
+
+        return now() - start;
+    }
+
+    config.rotate_requeue = (engine == ENGINE_ROTATE);
+    config.ready_queue = (engine >= ENGINE_RING) ? RR_READY_RING : RR_READY_LINKED;
+    config.skip_rounds = (engine == ENGINE_RING_SKIP);
+
+    start = now();
+    round_robin_with_config(task, quantum, size, &config, stats);
+
+    return now() - start;
+}
+
+
+///-------------------------------------------------
+/// @brief  Average wait time of the last run of an
+///         engine, summed without rounding
+///
+/// @param[in] engine Engine which ran
+/// @param[in] task Task array it scheduled
+/// @param[in] set Task set it scheduled
+/// @param[in] size Number of tasks
+///
+/// @return Average wait time
+///-------------------------------------------------
+static double averageWait(enum engine_t engine, struct task_t* task, struct task_set_t* set, int size)
+{
+    long long totalWait = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        totalWait += (engine == ENGINE_TASK_SET) ? set->waiting_time[i] : task[i].waiting_time;
+    }
+
+    return (double)totalWait / size;
+}
+
+
+///-------------------------------------------------
+/// @brief  Count the slices a workload takes
+///
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] quantum Length of a time slice
+///
+/// @return Number of slices
+///-------------------------------------------------
+static long long countSlices(int* execution, int size, int quantum)
+{
+    long long slices = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        long long rounds = ((long long)execution[i] + quantum - 1) / quantum;
+
+        slices += (rounds < 1) ? 1 : rounds;
+    }
+
+    return slices;
+}
+
+
+///-------------------------------------------------
+/// @brief  Fill the execution times from a burst
+///         distribution with a fixed seed
+///
+/// @param[out] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] distribution Distribution to use
+///-------------------------------------------------
+static void fillBursts(int* execution, int size, enum distribution_t distribution)
+{
+    unsigned int seed = 2024;
+
+    for(int i = 0; i < size; i++)
+    {
+        unsigned int draw = nextRandom(&seed);
+
+        switch(distribution)
+        {
+            case UNIFORM:
+                execution[i] = 1 + (int)(draw % 100);
+                break;
+
+            case CONSTANT:
+                execution[i] = 50;
+                break;
+
+            case EXPONENTIAL:
+                // Mean of about 50 by inverse transform
+                // sampling; draw is 24 bits wide
+                execution[i] = 1 + (int)(-49.5 * log((draw + 1.0) / 16777216.0));
+                break;
+
+            case BIMODAL:
+                // Mostly short interactive bursts with a few
+                // long batch jobs
+                execution[i] = ((draw % 10) == 0) ? (500 + (int)(nextRandom(&seed) % 501)) : (1 + (int)(nextRandom(&seed) % 10));
+                break;
+
+            default:
+                execution[i] = 1;
+                break;
+        }
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Linear congruential generator, so every
+///         run sees the same workload
+///
+/// @param[in] seed Generator state
+///
+/// @return The next pseudo-random value
+///-------------------------------------------------
+static unsigned int nextRandom(unsigned int* seed)
+{
+    *seed = (*seed * 1103515245u) + 12345u;
+
+    return (*seed >> 8);
+}
+
+
+///-------------------------------------------------
+/// @brief  Read the monotonic clock
+///
+/// @return Seconds since an arbitrary point
+///-------------------------------------------------
+static double now(void)
+{
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + (time.tv_nsec * 1e-9);
+}
+
+
+///-------------------------------------------------
+/// @brief  Peak resident set size of the process
+///
+/// @return Peak RSS in kilobytes
+///-------------------------------------------------
+static long peakRssKb(void)
+{
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+
+    return usage.ru_maxrss;
+}
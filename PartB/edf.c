@@ -0,0 +1,442 @@
+#include "edf.h"
+#include "events.h"
+#include <limits.h>
+
+
+// Kinds of entry of the release queue and of the
+// ready heap
+#define EVENT_RELEASE 0
+#define EVENT_DEADLINE 1
+
+
+///-------------------------------------------------
+/// @brief  Jobs of one task which were released
+///         but haven't completed
+///-------------------------------------------------
+struct edf_job_queue_t {
+    // Number of such jobs; each one is released a
+    // period after the one before it
+    long long pending;
+
+    // Release time and time left of the oldest one
+    long long release;
+    long long left;
+};
+
+
+///-------------------------------------------------
+/// @brief  State of a run
+///-------------------------------------------------
+struct edf_run_t {
+    struct task_t* task;
+    long long horizon;
+
+    // Key the ready heap on task priority instead of
+    // deadline
+    int fixedPriority;
+
+    // Next release of each task
+    struct event_queue_t releases;
+
+    // Tasks with pending jobs, keyed on the deadline
+    // of their oldest one or on their priority
+    struct event_queue_t ready;
+
+    // Pending jobs of each task
+    struct edf_job_queue_t* jobs;
+};
+
+
+static int isInvalidTask(struct task_t* task);
+static int hyperperiod(struct task_t* task, int size, long long* result);
+static int simulate(struct task_t* task, int size, long long horizon, int fixedPriority, struct edf_stats_t* stats,
+                    struct edf_task_stats_t* per_task);
+static long long deadlineOf(struct edf_run_t* run, int index);
+static long long keyOf(struct edf_run_t* run, int index);
+static int releaseJobs(struct edf_run_t* run, long long time);
+
+
+///-------------------------------------------------
+/// @brief  Earliest Deadline First scheduler over
+///         the jobs of periodic tasks
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] horizon End of the releases, or 0
+/// @param[out] stats What happened during the run
+/// @param[out] per_task Jobs of each task, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int earliest_deadline_first(struct task_t* task, int size, long long horizon, struct edf_stats_t* stats,
+                            struct edf_task_stats_t* per_task)
+{
+    return simulate(task, size, horizon, 0, stats, per_task);
+}
+
+
+///-------------------------------------------------
+/// @brief  Fixed priority preemptive scheduler over
+///         the jobs of periodic tasks
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] horizon End of the releases, or 0
+/// @param[out] stats What happened during the run
+/// @param[out] per_task Jobs of each task, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int fixed_priority_periodic(struct task_t* task, int size, long long horizon, struct edf_stats_t* stats,
+                            struct edf_task_stats_t* per_task)
+{
+    return simulate(task, size, horizon, 1, stats, per_task);
+}
+
+
+///-------------------------------------------------
+/// @brief  Run the ready job with the smallest key
+///         up to the next release and decide again
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] horizon End of the releases, or 0
+/// @param[in] fixedPriority Key on priority instead
+///                          of deadline
+/// @param[out] stats What happened during the run
+/// @param[out] per_task Jobs of each task, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+static int simulate(struct task_t* task, int size, long long horizon, int fixedPriority, struct edf_stats_t* stats,
+                    struct edf_task_stats_t* per_task)
+{
+    struct edf_run_t run;
+    long long lastRelease = 0;
+    long long totalResponse = 0;
+    long long now = 0;
+    int running = -1;
+    int status = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        if(isInvalidTask(&(task[i])))
+        {
+            fprintf(stderr, "%s() ERROR: Invalid task %d!\n", __func__, task[i].process_id);
+            return 1;
+        }
+
+        lastRelease = (task[i].arrival_time > lastRelease) ? task[i].arrival_time : lastRelease;
+    }
+
+    if(hyperperiod(task, size, &(stats->hyperperiod)))
+    {
+        return 1;
+    }
+
+    // NOTE: Without a periodic task every job is
+    //       released by the last first release
+    run.task = task;
+    run.fixedPriority = fixedPriority;
+    run.horizon = (horizon > 0) ? horizon : (lastRelease + ((stats->hyperperiod > 0) ? stats->hyperperiod : 1));
+    run.jobs = (struct edf_job_queue_t*)calloc((size_t)size + 1, sizeof(struct edf_job_queue_t));
+
+    // NOTE: One spare entry keeps an empty task set
+    //       from asking malloc for 0 bytes
+    struct edf_task_stats_t* ownStats = (per_task != NULL) ? NULL : (struct edf_task_stats_t*)malloc(((size_t)size + 1) * sizeof(struct edf_task_stats_t));
+    struct edf_task_stats_t* taskStats = (per_task != NULL) ? per_task : ownStats;
+
+    if((run.jobs == NULL) || (taskStats == NULL))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create jobs!\n", __func__);
+        free(run.jobs);
+        free(ownStats);
+        return 1;
+    }
+
+    if(event_queue_init(&(run.releases), size) || event_queue_init(&(run.ready), size))
+    {
+        event_queue_free(&(run.releases));
+        free(run.jobs);
+        free(ownStats);
+        return 1;
+    }
+
+    stats->horizon = run.horizon;
+    stats->makespan = 0;
+    stats->busy_time = 0;
+    stats->jobs = 0;
+    stats->misses = 0;
+    stats->max_lateness = LLONG_MIN;
+    stats->max_response = 0;
+    stats->average_response = 0;
+    stats->preemptions = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        taskStats[i].jobs = 0;
+        taskStats[i].misses = 0;
+        taskStats[i].max_lateness = LLONG_MIN;
+        taskStats[i].max_response = 0;
+        taskStats[i].total_response = 0;
+
+        if(task[i].arrival_time < run.horizon)
+        {
+            event_push(&(run.releases), task[i].arrival_time, EVENT_RELEASE, i);
+        }
+    }
+
+    while(status == 0)
+    {
+        const struct event_t* next = event_peek(&(run.releases));
+
+        if(running < 0)
+        {
+            struct event_t top;
+
+            if(!event_queue_is_empty(&(run.ready)))
+            {
+                event_pop(&(run.ready), &top);
+                running = top.index;
+            }
+            else if(next != NULL)
+            {
+                // Idle until the next release
+                now = next->time;
+                status = releaseJobs(&run, now);
+            }
+            else
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        struct edf_job_queue_t* job = &(run.jobs[running]);
+        long long finish = now + job->left;
+
+        // NOTE: A job released as the running one ends
+        //       is ready before the next one is picked
+        if((next != NULL) && (next->time <= finish))
+        {
+            // "Execute" the running job up to the release
+            job->left -= next->time - now;
+            stats->busy_time += next->time - now;
+            now = next->time;
+            status = releaseJobs(&run, now);
+
+            // Preempt only for a strictly earlier deadline
+            // (higher priority), and never a job which just
+            // completed
+            const struct event_t* earliest = event_peek(&(run.ready));
+
+            if((status == 0) && (job->left > 0) && (earliest != NULL) && (earliest->time < keyOf(&run, running)))
+            {
+                status = event_push(&(run.ready), keyOf(&run, running), EVENT_DEADLINE, running);
+                stats->preemptions++;
+                running = -1;
+            }
+
+            continue;
+        }
+
+        // "Execute" the running job to completion
+        long long response = finish - job->release;
+        long long lateness = finish - deadlineOf(&run, running);
+        struct edf_task_stats_t* jobStats = &(taskStats[running]);
+
+        stats->busy_time += job->left;
+        now = finish;
+
+        jobStats->jobs++;
+        jobStats->misses += (lateness > 0);
+        jobStats->max_lateness = (lateness > jobStats->max_lateness) ? lateness : jobStats->max_lateness;
+        jobStats->max_response = (response > jobStats->max_response) ? response : jobStats->max_response;
+        jobStats->total_response += response;
+        totalResponse += response;
+
+        // The next pending job of the task is released a
+        // period after this one
+        job->pending--;
+        job->release += task[running].period;
+        job->left = task[running].execution_time;
+
+        if(job->pending > 0)
+        {
+            status = event_push(&(run.ready), keyOf(&run, running), EVENT_DEADLINE, running);
+        }
+
+        running = -1;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        struct edf_task_stats_t* jobStats = &(taskStats[i]);
+
+        stats->jobs += jobStats->jobs;
+        stats->misses += jobStats->misses;
+        stats->max_lateness = (jobStats->max_lateness > stats->max_lateness) ? jobStats->max_lateness : stats->max_lateness;
+        stats->max_response = (jobStats->max_response > stats->max_response) ? jobStats->max_response : stats->max_response;
+
+        task[i].turnaround_time = (jobStats->max_response < INT_MAX) ? (int)jobStats->max_response : INT_MAX;
+        task[i].waiting_time = task[i].turnaround_time - task[i].execution_time;
+    }
+
+    stats->makespan = now;
+    stats->average_response = (stats->jobs > 0) ? ((double)totalResponse / stats->jobs) : 0;
+
+    // Cleanup
+    event_queue_free(&(run.ready));
+    event_queue_free(&(run.releases));
+    free(run.jobs);
+    free(ownStats);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check the timing of a task
+///
+/// @param[in] task The task
+///
+/// @return True if it can't be scheduled
+///-------------------------------------------------
+static int isInvalidTask(struct task_t* task)
+{
+    return (task->execution_time < 0) || (task->arrival_time < 0) || (task->period < 0) || (task->deadline < 0) ||
+           ((task->period == 0) && (task->deadline == 0));
+}
+
+
+///-------------------------------------------------
+/// @brief  Least common multiple of the periods of
+///         the periodic tasks
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[out] result The hyperperiod, 0 for none
+///
+/// @return 1: Overflow; 0: Success
+///-------------------------------------------------
+static int hyperperiod(struct task_t* task, int size, long long* result)
+{
+    long long lcm = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        long long period = task[i].period;
+        long long a = lcm;
+        long long b = period;
+
+        if(period == 0)
+        {
+            continue;
+        }
+
+        if(lcm == 0)
+        {
+            lcm = period;
+            continue;
+        }
+
+        while(b != 0)
+        {
+            long long remainder = a % b;
+
+            a = b;
+            b = remainder;
+        }
+
+        // NOTE: a is now gcd(lcm, period); half the range
+        //       is kept free for the release times
+        if((lcm / a) > (LLONG_MAX / 2 / period))
+        {
+            fprintf(stderr, "%s() ERROR: Hyperperiod overflows!\n", __func__);
+            return 1;
+        }
+
+        lcm = (lcm / a) * period;
+    }
+
+    *result = lcm;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Absolute deadline of the oldest pending
+///         job of a task
+///
+/// @param[in] run The run
+/// @param[in] index The task
+///
+/// @return The deadline
+///-------------------------------------------------
+static long long deadlineOf(struct edf_run_t* run, int index)
+{
+    struct task_t* task = &(run->task[index]);
+
+    return run->jobs[index].release + ((task->deadline > 0) ? task->deadline : task->period);
+}
+
+
+///-------------------------------------------------
+/// @brief  Key of a task in the ready heap
+///
+/// @param[in] run The run
+/// @param[in] index The task
+///
+/// @return Deadline of its oldest pending job, or
+///         its priority
+///-------------------------------------------------
+static long long keyOf(struct edf_run_t* run, int index)
+{
+    return run->fixedPriority ? run->task[index].priority : deadlineOf(run, index);
+}
+
+
+///-------------------------------------------------
+/// @brief  Release the jobs due at a time and
+///         schedule the next release of each task
+///
+/// @param[in] run The run
+/// @param[in] time Time of the releases
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int releaseJobs(struct edf_run_t* run, long long time)
+{
+    struct event_t event;
+
+    while(!event_queue_is_empty(&(run->releases)) && (event_peek(&(run->releases))->time == time))
+    {
+        event_pop(&(run->releases), &event);
+
+        struct task_t* task = &(run->task[event.index]);
+        struct edf_job_queue_t* job = &(run->jobs[event.index]);
+
+        // A task with no pending job becomes ready
+        if(job->pending++ == 0)
+        {
+            job->release = time;
+            job->left = task->execution_time;
+
+            if(event_push(&(run->ready), keyOf(run, event.index), EVENT_DEADLINE, event.index))
+            {
+                return 1;
+            }
+        }
+
+        if((task->period > 0) && ((time + task->period) < run->horizon))
+        {
+            // NOTE: The queue holds one release per task,
+            //       so this never has to grow
+            event_push(&(run->releases), time + task->period, EVENT_RELEASE, event.index);
+        }
+    }
+
+    return 0;
+}
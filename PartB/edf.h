@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __EARLIEST_DEADLINE_FIRST__
+#define __EARLIEST_DEADLINE_FIRST__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the jobs of one task during an earliest deadline first run
+//----------------------------------------------------------------------------------------------------------------------------------
+struct edf_task_stats_t {
+
+    // Number of jobs released, all of which ran to completion
+    long long jobs;
+
+    // Number of jobs which completed after their deadline
+    long long misses;
+
+    // Largest completion time minus deadline over the jobs, negative if every job was early
+    long long max_lateness;
+
+    // Largest time from the release of a job to its completion
+    long long max_response;
+
+    // Sum of the response times of the jobs
+    long long total_response;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds what happened during an earliest deadline first run
+//----------------------------------------------------------------------------------------------------------------------------------
+struct edf_stats_t {
+
+    // Least common multiple of the periods of the periodic tasks, 0 if there are none
+    long long hyperperiod;
+
+    // Time from which no more jobs were released
+    long long horizon;
+
+    // Time at which the last job completed
+    long long makespan;
+
+    // Time the CPU spent executing jobs
+    long long busy_time;
+
+    // Number of jobs released, all of which ran to completion
+    long long jobs;
+
+    // Number of jobs which completed after their deadline
+    long long misses;
+
+    // Largest completion time minus deadline over every job
+    long long max_lateness;
+
+    // Largest time from the release of a job to its completion
+    long long max_response;
+
+    // Average time from the release of a job to its completion
+    double average_response;
+
+    // Number of times a released job with an earlier deadline took the CPU from a running job
+    long long preemptions;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the preemptive earliest deadline first algorithm over the jobs of periodic and
+/// sporadic tasks, and measure their deadline misses, lateness and response times
+///
+/// @note Task i releases a job of execution_time at arrival_time and then every period (sporadic
+///       tasks are released as often as they may be, which is their worst case), each due deadline
+///       after its release. Jobs are released until the horizon, by default the last first release
+///       plus the hyperperiod, and every released job then runs to completion, late or not. The
+///       ready tasks are kept in a heap keyed on the absolute deadline of their oldest job and the
+///       next release of each task in a release queue (see events.h), so the cost is O(log n) per
+///       release, completion and preemption and doesn't depend on the length of the hyperperiod.
+///       Ties go to the task which became ready first, and only a strictly earlier deadline
+///       preempts. Each task's turnaround_time is set to its worst response time and its
+///       waiting_time to that minus its execution_time.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] horizon The time from which no more jobs are released, 0 for the default
+/// @param[out] stats What happened during the run
+/// @param[out] per_task The buffer receiving what happened to the jobs of each task, one entry per
+///                      task; may be NULL
+///
+/// @return 0 on success, 1 if a task is invalid, the hyperperiod overflows or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int earliest_deadline_first(struct task_t *task, int size, long long horizon, struct edf_stats_t *stats,
+                            struct edf_task_stats_t *per_task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the fixed priority preemptive algorithm over the jobs of periodic and sporadic tasks,
+/// and measure their deadline misses, lateness and response times
+///
+/// @note This is earliest_deadline_first() with the ready heap keyed on the priority of each task,
+///       0 being the highest, instead of on deadlines; tasks of the same priority run in the order
+///       they became ready. With every first release at 0 and each deadline at most the period,
+///       the worst response time of each task is the one response_time_analysis() computes (see
+///       rta.h).
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] horizon The time from which no more jobs are released, 0 for the default
+/// @param[out] stats What happened during the run; preemptions count a higher priority job taking
+///                   the CPU
+/// @param[out] per_task The buffer receiving what happened to the jobs of each task, one entry per
+///                      task; may be NULL
+///
+/// @return 0 on success, 1 if a task is invalid, the hyperperiod overflows or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int fixed_priority_periodic(struct task_t *task, int size, long long horizon, struct edf_stats_t *stats,
+                            struct edf_task_stats_t *per_task);
+
+#endif // __EARLIEST_DEADLINE_FIRST__
@@ -0,0 +1,187 @@
+#include "events.h"
+
+
+#define EVENT_MIN_CAPACITY 16
+
+
+static int isEarlier(const struct event_t* left, const struct event_t* right);
+
+
+///-------------------------------------------------
+/// @brief  Create an empty event heap
+///
+/// @param[out] queue The event queue
+/// @param[in] capacity Initial number of events
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int event_queue_init(struct event_queue_t* queue, int capacity)
+{
+    queue->capacity = (capacity > EVENT_MIN_CAPACITY) ? capacity : EVENT_MIN_CAPACITY;
+    queue->size = 0;
+    queue->pushed = 0;
+    queue->heap = (struct event_t*)malloc((size_t)queue->capacity * sizeof(struct event_t));
+
+    if(queue->heap == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create event queue!\n", __func__);
+        queue->capacity = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Push an event and sift it up to its
+///         place in the heap
+///
+/// @param[in] queue The event queue
+/// @param[in] time Time of the event
+/// @param[in] kind What happens
+/// @param[in] index Task the event is about
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int event_push(struct event_queue_t* queue, long long time, int kind, int index)
+{
+    if(queue->size == queue->capacity)
+    {
+        int capacity = (queue->capacity > 0) ? (2 * queue->capacity) : EVENT_MIN_CAPACITY;
+        struct event_t* heap = (struct event_t*)realloc(queue->heap, (size_t)capacity * sizeof(struct event_t));
+
+        if(heap == NULL)
+        {
+            fprintf(stderr, "%s() ERROR: Couldn't grow event queue!\n", __func__);
+            return 1;
+        }
+
+        queue->heap = heap;
+        queue->capacity = capacity;
+    }
+
+    struct event_t event = {time, queue->pushed++, kind, index};
+    int slot = queue->size++;
+
+    // Move parents down until the new event's slot
+    // is found
+    while(slot > 0)
+    {
+        int parent = (slot - 1) / 2;
+
+        if(!isEarlier(&event, &(queue->heap[parent])))
+        {
+            break;
+        }
+
+        queue->heap[slot] = queue->heap[parent];
+        slot = parent;
+    }
+
+    queue->heap[slot] = event;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the top of the heap
+///
+/// @param[in] queue The event queue
+///
+/// @return The earliest event; NULL: Empty
+///-------------------------------------------------
+const struct event_t* event_peek(struct event_queue_t* queue)
+{
+    return (queue->size > 0) ? &(queue->heap[0]) : NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the earliest event and sift the
+///         last one down into the hole
+///
+/// @param[in] queue The event queue
+/// @param[out] event The earliest event
+///-------------------------------------------------
+void event_pop(struct event_queue_t* queue, struct event_t* event)
+{
+    *event = queue->heap[0];
+
+    struct event_t last = queue->heap[--queue->size];
+    int slot = 0;
+
+    for(;;)
+    {
+        int child = (2 * slot) + 1;
+
+        if(child >= queue->size)
+        {
+            break;
+        }
+
+        if(((child + 1) < queue->size) && isEarlier(&(queue->heap[child + 1]), &(queue->heap[child])))
+        {
+            child++;
+        }
+
+        if(!isEarlier(&(queue->heap[child]), &last))
+        {
+            break;
+        }
+
+        queue->heap[slot] = queue->heap[child];
+        slot = child;
+    }
+
+    queue->heap[slot] = last;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check if the event queue is empty
+///
+/// @param[in] queue The event queue
+///
+/// @return True/False
+///-------------------------------------------------
+int event_queue_is_empty(struct event_queue_t* queue)
+{
+    return (queue->size == 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the event heap
+///
+/// @param[in] queue The event queue
+///-------------------------------------------------
+void event_queue_free(struct event_queue_t* queue)
+{
+    free(queue->heap);
+
+    queue->heap = NULL;
+    queue->size = 0;
+    queue->capacity = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Order two events by time, then by the
+///         order they were pushed in
+///
+/// @param[in] left The first event
+/// @param[in] right The second event
+///
+/// @return True if left happens first
+///-------------------------------------------------
+static int isEarlier(const struct event_t* left, const struct event_t* right)
+{
+    if(left->time != right->time)
+    {
+        return (left->time < right->time);
+    }
+
+    return (left->sequence < right->sequence);
+}
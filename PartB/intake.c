@@ -0,0 +1,131 @@
+#include "intake.h"
+
+
+static void linkNode(struct intake_queue_t* intake, struct intake_node_t* node);
+
+
+///-------------------------------------------------
+/// @brief  Create an empty queue holding only the
+///         stub node
+///
+/// @param[out] intake The queue
+///-------------------------------------------------
+void intake_init(struct intake_queue_t* intake)
+{
+    intake->stub.next = NULL;
+    intake->stub.task = NULL;
+    intake->head = &(intake->stub);
+    intake->tail = &(intake->stub);
+    intake->closed = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task from any thread
+///
+/// @param[in] intake The queue
+/// @param[in] node Storage for the link
+/// @param[in] task The task
+///-------------------------------------------------
+void intake_push(struct intake_queue_t* intake, struct intake_node_t* node, struct task_t* task)
+{
+    node->task = task;
+
+    linkNode(intake, node);
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the oldest linked task, stepping
+///         over the stub node
+///
+/// @param[in] intake The queue
+///
+/// @return The task; NULL: Nothing to take yet
+///-------------------------------------------------
+struct task_t* intake_pop(struct intake_queue_t* intake)
+{
+    struct intake_node_t* tail = intake->tail;
+    struct intake_node_t* next = __atomic_load_n(&(tail->next), __ATOMIC_ACQUIRE);
+
+    if(tail == &(intake->stub))
+    {
+        if(next == NULL)
+        {
+            return NULL;
+        }
+
+        intake->tail = next;
+        tail = next;
+        next = __atomic_load_n(&(next->next), __ATOMIC_ACQUIRE);
+    }
+
+    if(next != NULL)
+    {
+        intake->tail = next;
+        return tail->task;
+    }
+
+    // NOTE: tail is the last node linked, unless a
+    //       producer has swapped the head but not yet
+    //       linked its node after tail
+    if(tail != __atomic_load_n(&(intake->head), __ATOMIC_ACQUIRE))
+    {
+        return NULL;
+    }
+
+    // Put the stub back behind tail, so tail can be
+    // taken without leaving the queue empty of nodes
+    linkNode(intake, &(intake->stub));
+
+    next = __atomic_load_n(&(tail->next), __ATOMIC_ACQUIRE);
+
+    if(next != NULL)
+    {
+        intake->tail = next;
+        return tail->task;
+    }
+
+    return NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Mark the queue closed
+///
+/// @param[in] intake The queue
+///-------------------------------------------------
+void intake_close(struct intake_queue_t* intake)
+{
+    __atomic_store_n(&(intake->closed), 1, __ATOMIC_RELEASE);
+}
+
+
+///-------------------------------------------------
+/// @brief  Check whether the queue was closed
+///
+/// @param[in] intake The queue
+///
+/// @return 1: Closed; 0: Open
+///-------------------------------------------------
+int intake_is_closed(struct intake_queue_t* intake)
+{
+    return __atomic_load_n(&(intake->closed), __ATOMIC_ACQUIRE);
+}
+
+
+///-------------------------------------------------
+/// @brief  Swap a node in as the head, then link
+///         it after the previous head
+///
+/// @param[in] intake The queue
+/// @param[in] node The node
+///-------------------------------------------------
+static void linkNode(struct intake_queue_t* intake, struct intake_node_t* node)
+{
+    __atomic_store_n(&(node->next), NULL, __ATOMIC_RELAXED);
+
+    struct intake_node_t* previous = __atomic_exchange_n(&(intake->head), node, __ATOMIC_ACQ_REL);
+
+    __atomic_store_n(&(previous->next), node, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,386 @@
+#include "metrics.h"
+
+
+// Buckets in each power of two range past the first
+#define HISTOGRAM_HALF (1 << (HISTOGRAM_SUB_BITS - 1))
+
+
+static int bucketOf(long long value);
+static long long bucketTop(int bucket);
+static long long rankOf(long long count, double percentile);
+
+
+///-------------------------------------------------
+/// @brief  Create an empty summary
+///
+/// @param[out] metric The summary
+///-------------------------------------------------
+void metric_init(struct metric_t* metric)
+{
+    metric->count = 0;
+    metric->sum = 0;
+    metric->min = 0;
+    metric->max = 0;
+    metric->mean = 0;
+    metric->m2 = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Record a value with Welford's update
+///
+/// @param[in] metric The summary
+/// @param[in] value The value
+///-------------------------------------------------
+void metric_add(struct metric_t* metric, long long value)
+{
+    if((metric->count == 0) || (value < metric->min))
+    {
+        metric->min = value;
+    }
+
+    if((metric->count == 0) || (value > metric->max))
+    {
+        metric->max = value;
+    }
+
+    metric->count++;
+    metric->sum += value;
+
+    double delta = value - metric->mean;
+
+    metric->mean += delta / metric->count;
+    metric->m2 += delta * (value - metric->mean);
+}
+
+
+///-------------------------------------------------
+/// @brief  Combine two summaries with the pairwise
+///         form of Welford's update
+///
+/// @param[in] metric The summary receiving values
+/// @param[in] other The summary to add
+///-------------------------------------------------
+void metric_merge(struct metric_t* metric, const struct metric_t* other)
+{
+    if(other->count == 0)
+    {
+        return;
+    }
+
+    if(metric->count == 0)
+    {
+        *metric = *other;
+        return;
+    }
+
+    long long count = metric->count + other->count;
+    double delta = other->mean - metric->mean;
+
+    metric->min = (other->min < metric->min) ? other->min : metric->min;
+    metric->max = (other->max > metric->max) ? other->max : metric->max;
+    metric->mean += delta * other->count / count;
+    metric->m2 += other->m2 + (delta * delta * ((double)metric->count * other->count / count));
+    metric->sum += other->sum;
+    metric->count = count;
+}
+
+
+///-------------------------------------------------
+/// @brief  Mean from the exact sum
+///
+/// @param[in] metric The summary
+///
+/// @return The mean; 0: Empty
+///-------------------------------------------------
+double metric_mean(const struct metric_t* metric)
+{
+    return (metric->count > 0) ? ((double)metric->sum / metric->count) : 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Population variance
+///
+/// @param[in] metric The summary
+///
+/// @return The variance; 0: Empty
+///-------------------------------------------------
+double metric_variance(const struct metric_t* metric)
+{
+    return (metric->count > 0) ? (metric->m2 / metric->count) : 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Allocate zeroed buckets
+///
+/// @param[out] histogram The histogram
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int histogram_init(struct histogram_t* histogram)
+{
+    histogram->count = 0;
+    histogram->max = 0;
+    histogram->bucket = (long long*)calloc(HISTOGRAM_BUCKETS, sizeof(long long));
+
+    if(histogram->bucket == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create buckets!\n", __func__);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Count a value in its bucket
+///
+/// @param[in] histogram The histogram
+/// @param[in] value The value
+///-------------------------------------------------
+void histogram_record(struct histogram_t* histogram, long long value)
+{
+    value = (value < 0) ? 0 : value;
+
+    histogram->bucket[bucketOf(value)]++;
+    histogram->max = ((histogram->count == 0) || (value > histogram->max)) ? value : histogram->max;
+    histogram->count++;
+}
+
+
+///-------------------------------------------------
+/// @brief  Add the buckets of another histogram
+///
+/// @param[in] histogram Histogram receiving values
+/// @param[in] other The histogram to add
+///-------------------------------------------------
+void histogram_merge(struct histogram_t* histogram, const struct histogram_t* other)
+{
+    if(other->count == 0)
+    {
+        return;
+    }
+
+    for(int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        histogram->bucket[i] += other->bucket[i];
+    }
+
+    histogram->max = ((histogram->count == 0) || (other->max > histogram->max)) ? other->max : histogram->max;
+    histogram->count += other->count;
+}
+
+
+///-------------------------------------------------
+/// @brief  Walk the buckets up to a rank
+///
+/// @param[in] histogram The histogram
+/// @param[in] percentile Percentage, 0 to 100
+///
+/// @return The value; 0: Empty
+///-------------------------------------------------
+long long histogram_percentile(const struct histogram_t* histogram, double percentile)
+{
+    long long rank = rankOf(histogram->count, percentile);
+    long long seen = 0;
+
+    if(histogram->count == 0)
+    {
+        return 0;
+    }
+
+    for(int i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        seen += histogram->bucket[i];
+
+        if(seen >= rank)
+        {
+            long long top = bucketTop(i);
+
+            return (top < histogram->max) ? top : histogram->max;
+        }
+    }
+
+    return histogram->max;
+}
+
+
+///-------------------------------------------------
+/// @brief  Find every reported percentile in one
+///         walk over the buckets
+///
+/// @param[in] histogram The histogram
+/// @param[out] percentiles The percentiles
+///-------------------------------------------------
+void histogram_percentiles(const struct histogram_t* histogram, struct latency_percentiles_t* percentiles)
+{
+    const double wanted[] = {50, 90, 99, 99.9};
+    long long* value[] = {&(percentiles->p50), &(percentiles->p90), &(percentiles->p99), &(percentiles->p999)};
+    long long seen = 0;
+    int next = 0;
+
+    percentiles->max = histogram->max;
+
+    for(int i = 0; i < 4; i++)
+    {
+        *(value[i]) = 0;
+    }
+
+    for(int i = 0; (i < HISTOGRAM_BUCKETS) && (histogram->count > 0) && (next < 4); i++)
+    {
+        seen += histogram->bucket[i];
+
+        // NOTE: One bucket can hold several of the ranks
+        while((next < 4) && (seen >= rankOf(histogram->count, wanted[next])))
+        {
+            long long top = bucketTop(i);
+
+            *(value[next]) = (top < histogram->max) ? top : histogram->max;
+            next++;
+        }
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the buckets
+///
+/// @param[in] histogram The histogram
+///-------------------------------------------------
+void histogram_free(struct histogram_t* histogram)
+{
+    free(histogram->bucket);
+
+    histogram->bucket = NULL;
+    histogram->count = 0;
+    histogram->max = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Create empty wait and turnaround
+///         summaries
+///
+/// @param[out] metrics The summaries
+///-------------------------------------------------
+void run_metrics_init(struct run_metrics_t* metrics)
+{
+    metric_init(&(metrics->wait));
+    metric_init(&(metrics->turnaround));
+
+    metrics->wait_histogram = NULL;
+    metrics->turnaround_histogram = NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Record the times of a finished task
+///
+/// @param[in] metrics The summaries
+/// @param[in] waiting_time Wait time
+/// @param[in] turnaround_time Turnaround time
+///-------------------------------------------------
+void run_metrics_add(struct run_metrics_t* metrics, long long waiting_time, long long turnaround_time)
+{
+    metric_add(&(metrics->wait), waiting_time);
+    metric_add(&(metrics->turnaround), turnaround_time);
+
+    if(metrics->wait_histogram != NULL)
+    {
+        histogram_record(metrics->wait_histogram, waiting_time);
+    }
+
+    if(metrics->turnaround_histogram != NULL)
+    {
+        histogram_record(metrics->turnaround_histogram, turnaround_time);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Combine two sets of summaries
+///
+/// @param[in] metrics The summaries receiving times
+/// @param[in] other The summaries to add
+///-------------------------------------------------
+void run_metrics_merge(struct run_metrics_t* metrics, const struct run_metrics_t* other)
+{
+    metric_merge(&(metrics->wait), &(other->wait));
+    metric_merge(&(metrics->turnaround), &(other->turnaround));
+}
+
+
+///-------------------------------------------------
+/// @brief  Bucket of a value: the value itself
+///         when small, else its power of two range
+///         and the next bits below the leading one
+///
+/// @param[in] value The value, at least 0
+///
+/// @return The bucket
+///-------------------------------------------------
+static int bucketOf(long long value)
+{
+    if(value < (1 << HISTOGRAM_SUB_BITS))
+    {
+        return (int)value;
+    }
+
+    if(value > 0xFFFFFFFFLL)
+    {
+        return HISTOGRAM_BUCKETS - 1;
+    }
+
+    int magnitude = 63 - __builtin_clzll((unsigned long long)value);
+    int shift = magnitude - HISTOGRAM_SUB_BITS + 1;
+
+    return (1 << HISTOGRAM_SUB_BITS) + ((magnitude - HISTOGRAM_SUB_BITS) * HISTOGRAM_HALF) +
+           (int)((value >> shift) - HISTOGRAM_HALF);
+}
+
+
+///-------------------------------------------------
+/// @brief  Largest value which falls in a bucket
+///
+/// @param[in] bucket The bucket
+///
+/// @return The value
+///-------------------------------------------------
+static long long bucketTop(int bucket)
+{
+    if(bucket < (1 << HISTOGRAM_SUB_BITS))
+    {
+        return bucket;
+    }
+
+    int offset = bucket - (1 << HISTOGRAM_SUB_BITS);
+    int shift = (offset / HISTOGRAM_HALF) + 1;
+    long long top = HISTOGRAM_HALF + (offset % HISTOGRAM_HALF);
+
+    return ((top + 1) << shift) - 1;
+}
+
+
+///-------------------------------------------------
+/// @brief  Nearest rank of a percentile
+///
+/// @param[in] count Number of values
+/// @param[in] percentile Percentage, 0 to 100
+///
+/// @return The rank, from 1 to count
+///-------------------------------------------------
+static long long rankOf(long long count, double percentile)
+{
+    long long rank = (long long)((percentile / 100.0) * count);
+
+    // NOTE: Round up, unless the product was exact
+    if((double)rank < ((percentile / 100.0) * count))
+    {
+        rank++;
+    }
+
+    return (rank < 1) ? 1 : ((rank > count) ? count : rank);
+}
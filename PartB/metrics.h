@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef __METRICS__
+#define __METRICS__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Running summary of a stream of times, updated in O(1) per value
+///
+/// @note The sum is exact in 64 bits, and the variance is kept with Welford's update, which doesn't
+///       lose precision to the cancellation that summing squares suffers once the sum is large.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct metric_t {
+
+    // Number of values recorded
+    long long count;
+
+    // Sum of the values
+    long long sum;
+
+    // Smallest value recorded, 0 if none
+    long long min;
+
+    // Largest value recorded, 0 if none
+    long long max;
+
+    // Mean of the values so far
+    double mean;
+
+    // Sum of the squared differences of the values from their mean
+    double m2;
+};
+
+// Number of bits of a value a histogram keeps; each power of two range holds 2^(bits - 1) buckets,
+// so a bucket is less than 1/128 of its values wide
+#define HISTOGRAM_SUB_BITS 8
+
+// Values from 0 to 2^32 - 1 are told apart; larger ones share the last bucket
+#define HISTOGRAM_BUCKETS ((1 << HISTOGRAM_SUB_BITS) + ((32 - HISTOGRAM_SUB_BITS) << (HISTOGRAM_SUB_BITS - 1)))
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Log-bucketed histogram of a stream of times, in the style of HdrHistogram
+///
+/// @note Values below 2^HISTOGRAM_SUB_BITS have a bucket each. Above that, every range from 2^m to
+///       2^(m + 1) is cut into 2^(HISTOGRAM_SUB_BITS - 1) equal buckets, so a percentile is within
+///       1/128 of the exact one whatever the scale. Recording a value is a count-leading-zeros and
+///       an increment, and two histograms merge by adding their buckets.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct histogram_t {
+
+    // Number of values recorded
+    long long count;
+
+    // Largest value recorded, 0 if none
+    long long max;
+
+    // Number of values in each bucket, NULL until histogram_init()
+    long long* bucket;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the tail of a distribution of times
+//----------------------------------------------------------------------------------------------------------------------------------
+struct latency_percentiles_t {
+
+    // Median
+    long long p50;
+
+    // 90th percentile
+    long long p90;
+
+    // 99th percentile
+    long long p99;
+
+    // 99.9th percentile
+    long long p999;
+
+    // Largest value, exact
+    long long max;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the summaries of the times of the tasks a scheduler finished
+//----------------------------------------------------------------------------------------------------------------------------------
+struct run_metrics_t {
+
+    // Wait times
+    struct metric_t wait;
+
+    // Turn around times
+    struct metric_t turnaround;
+
+    // Histogram the wait times are also recorded in, NULL for none
+    struct histogram_t* wait_histogram;
+
+    // Histogram the turn around times are also recorded in, NULL for none
+    struct histogram_t* turnaround_histogram;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty summary
+///
+/// @param[out] metric The summary
+//----------------------------------------------------------------------------------------------------------------------------------
+void metric_init(struct metric_t *metric);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Record a value
+///
+/// @param[in] metric The summary
+/// @param[in] value The value
+//----------------------------------------------------------------------------------------------------------------------------------
+void metric_add(struct metric_t *metric, long long value);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add the values of one summary to another, as if they had all been recorded in it
+///
+/// @param[in] metric The summary receiving the values
+/// @param[in] other The summary to add
+//----------------------------------------------------------------------------------------------------------------------------------
+void metric_merge(struct metric_t *metric, const struct metric_t *other);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the mean of the values
+///
+/// @param[in] metric The summary
+///
+/// @return The mean, 0 if no value was recorded
+//----------------------------------------------------------------------------------------------------------------------------------
+double metric_mean(const struct metric_t *metric);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the population variance of the values
+///
+/// @param[in] metric The summary
+///
+/// @return The variance, 0 if no value was recorded
+//----------------------------------------------------------------------------------------------------------------------------------
+double metric_variance(const struct metric_t *metric);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty histogram
+///
+/// @param[out] histogram The histogram
+///
+/// @return 0 on success, 1 if the buckets couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int histogram_init(struct histogram_t *histogram);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Record a value in O(1); a negative value counts as 0
+///
+/// @param[in] histogram The histogram
+/// @param[in] value The value
+//----------------------------------------------------------------------------------------------------------------------------------
+void histogram_record(struct histogram_t *histogram, long long value);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add the values of one histogram to another, e.g. to combine the runs of several threads
+///
+/// @param[in] histogram The histogram receiving the values
+/// @param[in] other The histogram to add
+//----------------------------------------------------------------------------------------------------------------------------------
+void histogram_merge(struct histogram_t *histogram, const struct histogram_t *other);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the value below which a percentage of the values lie (nearest rank)
+///
+/// @param[in] histogram The histogram
+/// @param[in] percentile The percentage, 0 to 100
+///
+/// @return The largest value of the bucket holding that rank, at most the largest value recorded;
+///         0 if no value was recorded
+//----------------------------------------------------------------------------------------------------------------------------------
+long long histogram_percentile(const struct histogram_t *histogram, double percentile);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the p50, p90, p99, p99.9 and maximum of a histogram in one pass over its buckets
+///
+/// @param[in] histogram The histogram
+/// @param[out] percentiles The percentiles
+//----------------------------------------------------------------------------------------------------------------------------------
+void histogram_percentiles(const struct histogram_t *histogram, struct latency_percentiles_t *percentiles);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the buckets of a histogram
+///
+/// @param[in] histogram The histogram
+//----------------------------------------------------------------------------------------------------------------------------------
+void histogram_free(struct histogram_t *histogram);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create empty summaries of the wait and turn around times, recorded in no histogram
+///
+/// @param[out] metrics The summaries
+//----------------------------------------------------------------------------------------------------------------------------------
+void run_metrics_init(struct run_metrics_t *metrics);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Record the final times of a task which just finished, in the histograms too if any
+///
+/// @param[in] metrics The summaries
+/// @param[in] waiting_time Wait time of the task
+/// @param[in] turnaround_time Turn around time of the task
+//----------------------------------------------------------------------------------------------------------------------------------
+void run_metrics_add(struct run_metrics_t *metrics, long long waiting_time, long long turnaround_time);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add the times of one set of summaries to another; the histograms are left alone
+///
+/// @param[in] metrics The summaries receiving the times
+/// @param[in] other The summaries to add
+//----------------------------------------------------------------------------------------------------------------------------------
+void run_metrics_merge(struct run_metrics_t *metrics, const struct run_metrics_t *other);
+
+#endif // __METRICS__
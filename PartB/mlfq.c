@@ -0,0 +1,554 @@
+#include "mlfq.h"
+#include "events.h"
+#include <limits.h>
+
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+
+// Kinds of events, in the order they are handled
+// when they happen at the same time
+#define EVENT_ARRIVAL 0
+#define EVENT_BOOST 1
+
+
+///-------------------------------------------------
+/// @brief  State of one multilevel feedback queue
+///         run
+///-------------------------------------------------
+struct mlfq_run_t {
+    struct task_t* task;
+    const struct mlfq_config_t* config;
+    struct event_queue_t events;
+    struct mlfq_ready_t ready;
+
+    // Time each task has run at its level, valid
+    // only while its epoch is the current one
+    int* used;
+    long long* epoch;
+
+    // Number of boosts so far
+    long long boosts;
+
+    // Tasks which haven't finished
+    int remaining;
+};
+
+
+static int isInvalidConfig(const struct mlfq_config_t* config);
+static int handleEvents(struct mlfq_run_t* run, long long time, int idle, int* boosted);
+static int usedAtLevel(struct mlfq_run_t* run, int index);
+
+
+///-------------------------------------------------
+/// @brief  Configure levels of doubling quantum
+///
+/// @param[in] levels Number of levels
+/// @param[in] quantum Quantum of level 0
+///
+/// @return The configuration
+///-------------------------------------------------
+struct mlfq_config_t mlfq_default_config(int levels, int quantum)
+{
+    struct mlfq_config_t config;
+
+    config.levels = (levels < 1) ? 1 : MIN(levels, MLFQ_MAX_LEVELS);
+    config.boost_interval = 0;
+
+    config.quantum[0] = quantum;
+
+    // NOTE: The quantum stops doubling before it
+    //       would overflow
+    for(int i = 1; i < MLFQ_MAX_LEVELS; i++)
+    {
+        config.quantum[i] = (config.quantum[i - 1] <= (INT_MAX / 2)) ? (config.quantum[i - 1] * 2) : config.quantum[i - 1];
+    }
+
+    return config;
+}
+
+
+///-------------------------------------------------
+/// @brief  Create an empty ready list
+///
+/// @param[out] ready The ready list
+/// @param[in] levels Number of levels
+/// @param[in] capacity Nodes in the first chunk
+///-------------------------------------------------
+void mlfq_ready_init(struct mlfq_ready_t* ready, int levels, int capacity)
+{
+    ready->map = 0;
+    ready->levels = levels;
+
+    for(int i = 0; i < MLFQ_MAX_LEVELS; i++)
+    {
+        ready->level[i].head = NULL;
+        ready->level[i].tail = NULL;
+    }
+
+    pool_init(&(ready->pool), capacity);
+}
+
+
+///-------------------------------------------------
+/// @brief  Append a task to a level and mark the
+///         level ready
+///
+/// @param[in] ready The ready list
+/// @param[in] level The level
+/// @param[in] task The task
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int mlfq_ready_push(struct mlfq_ready_t* ready, int level, struct task_t* task)
+{
+    struct node_t* node = pool_alloc(&(ready->pool), task);
+
+    if(node == NULL)
+    {
+        return 1;
+    }
+
+    if(ready->level[level].head == NULL)
+    {
+        ready->level[level].head = node;
+    }
+    else
+    {
+        ready->level[level].tail->next = node;
+    }
+
+    ready->level[level].tail = node;
+    ready->map |= (1u << (31 - level));
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Find the highest ready level with one
+///         count-leading-zeros
+///
+/// @param[in] ready The ready list
+///
+/// @return The level; -1: Empty
+///-------------------------------------------------
+int mlfq_ready_highest(struct mlfq_ready_t* ready)
+{
+    // NOTE: __builtin_clz() is undefined for 0
+    if(ready->map == 0)
+    {
+        return -1;
+    }
+
+    return __builtin_clz(ready->map);
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the head of the highest ready level
+///         and clear its bit once it is empty
+///
+/// @param[in] ready The ready list
+/// @param[out] level Level of the task, or NULL
+///
+/// @return The task; NULL: Empty
+///-------------------------------------------------
+struct task_t* mlfq_ready_pop(struct mlfq_ready_t* ready, int* level)
+{
+    int highest = mlfq_ready_highest(ready);
+
+    if(highest < 0)
+    {
+        return NULL;
+    }
+
+    struct node_t* node = ready->level[highest].head;
+    struct task_t* task = node->task;
+
+    ready->level[highest].head = node->next;
+
+    if(ready->level[highest].head == NULL)
+    {
+        ready->level[highest].tail = NULL;
+        ready->map &= ~(1u << (31 - highest));
+    }
+
+    pool_free(&(ready->pool), node);
+
+    if(level != NULL)
+    {
+        *level = highest;
+    }
+
+    return task;
+}
+
+
+///-------------------------------------------------
+/// @brief  Link every lower level onto the tail of
+///         level 0, highest first
+///
+/// @param[in] ready The ready list
+///-------------------------------------------------
+void mlfq_ready_boost(struct mlfq_ready_t* ready)
+{
+    struct mlfq_level_t* top = &(ready->level[0]);
+
+    for(int i = 1; i < ready->levels; i++)
+    {
+        struct mlfq_level_t* level = &(ready->level[i]);
+
+        if(level->head == NULL)
+        {
+            continue;
+        }
+
+        if(top->head == NULL)
+        {
+            top->head = level->head;
+        }
+        else
+        {
+            top->tail->next = level->head;
+        }
+
+        top->tail = level->tail;
+        level->head = NULL;
+        level->tail = NULL;
+    }
+
+    ready->map = (top->head != NULL) ? (1u << 31) : 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the nodes of every level
+///
+/// @param[in] ready The ready list
+///-------------------------------------------------
+void mlfq_ready_free(struct mlfq_ready_t* ready)
+{
+    pool_release(&(ready->pool));
+
+    mlfq_ready_init(ready, ready->levels, 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Multilevel feedback queue scheduler,
+///         which runs the current slice up to the
+///         next event and decides again
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] config The levels
+/// @param[in] trace Sink for the times, or NULL
+/// @param[out] stats Counters of the run, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int multilevel_feedback_queue(struct task_t* task, int size, const struct mlfq_config_t* config, struct trace_sink_t* trace,
+                              struct mlfq_stats_t* stats)
+{
+    struct mlfq_run_t run;
+    struct task_t* running = NULL;
+    long long now = 0;
+    long long slices = 0;
+    long long switches = 0;
+    long long demotions = 0;
+    long long preemptions = 0;
+    int level = 0;
+    int sliceLeft = 0;
+    int lastTaskRan = INT_MAX;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    if(isInvalidConfig(config))
+    {
+        return 1;
+    }
+
+    run.task = task;
+    run.config = config;
+    run.boosts = 0;
+    run.remaining = size;
+
+    // NOTE: One spare entry keeps an empty task set
+    //       from asking malloc for 0 bytes
+    run.used = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    run.epoch = (long long*)malloc(((size_t)size + 1) * sizeof(long long));
+
+    if((run.used == NULL) || (run.epoch == NULL) || event_queue_init(&(run.events), size + 1))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create run!\n", __func__);
+        free(run.used);
+        free(run.epoch);
+        return 1;
+    }
+
+    mlfq_ready_init(&(run.ready), config->levels, size);
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; i < size; i++)
+    {
+        run.used[i] = 0;
+        run.epoch[i] = 0;
+        event_push(&(run.events), task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    if((size > 0) && (config->boost_interval > 0))
+    {
+        event_push(&(run.events), config->boost_interval, EVENT_BOOST, 0);
+    }
+
+    while(status == 0)
+    {
+        const struct event_t* next = event_peek(&(run.events));
+        int boosted = 0;
+
+        if(running == NULL)
+        {
+            if(run.ready.map != 0)
+            {
+                running = mlfq_ready_pop(&(run.ready), &level);
+            }
+            else if(next != NULL)
+            {
+                // Idle until the next event
+                now = next->time;
+                status = handleEvents(&run, now, 1, &boosted);
+                continue;
+            }
+            else
+            {
+                break;
+            }
+
+            // Start a slice of what is left of the
+            // task's quantum at its level
+            sliceLeft = MIN(running->left_to_execute, config->quantum[level] - usedAtLevel(&run, (int)(running - task)));
+            slices++;
+
+            if(lastTaskRan != running->process_id)
+            {
+                switches += (lastTaskRan != INT_MAX);
+            }
+
+            lastTaskRan = running->process_id;
+            continue;
+        }
+
+        long long sliceEnd = now + sliceLeft;
+        int index = (int)(running - task);
+
+        // NOTE: An event as the slice ends is handled
+        //       before the task is requeued
+        if((next != NULL) && (next->time <= sliceEnd))
+        {
+            // "Execute" the slice up to the event
+            int taskRuntime = (int)(next->time - now);
+
+            running->left_to_execute -= taskRuntime;
+            run.used[index] = usedAtLevel(&run, index) + taskRuntime;
+            sliceLeft -= taskRuntime;
+            now = next->time;
+            status = handleEvents(&run, now, 0, &boosted);
+
+            if((status == 0) && boosted)
+            {
+                // NOTE: The boost has already reset the time
+                //       the task used
+                level = 0;
+
+                if((sliceLeft > 0) && (run.ready.map != 0))
+                {
+                    status = mlfq_ready_push(&(run.ready), level, running);
+                    running = NULL;
+                    preemptions++;
+                }
+                else if(sliceLeft > 0)
+                {
+                    // Nothing else is ready, so the task runs
+                    // on with a fresh quantum
+                    sliceLeft = MIN(running->left_to_execute, config->quantum[0]);
+                }
+            }
+            else if((status == 0) && (sliceLeft > 0) && (run.ready.map != 0) && (mlfq_ready_highest(&(run.ready)) < level))
+            {
+                status = mlfq_ready_push(&(run.ready), level, running);
+                running = NULL;
+                preemptions++;
+            }
+
+            continue;
+        }
+
+        // "Execute" the rest of the slice
+        running->left_to_execute -= sliceLeft;
+        run.used[index] = usedAtLevel(&run, index) + sliceLeft;
+        now = sliceEnd;
+        sliceLeft = 0;
+
+        // Calculate task wait time and turnaround time
+        // as of the end of its slice
+        running->turnaround_time = (int)(now - running->arrival_time);
+        running->waiting_time = running->turnaround_time - (running->execution_time - running->left_to_execute);
+
+        trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+
+        if(running->left_to_execute == 0)
+        {
+            run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+            run.remaining--;
+        }
+        else
+        {
+            // Move a task which used up its quantum down a
+            // level, where it starts afresh
+            if(run.used[index] >= config->quantum[level])
+            {
+                demotions += (level + 1 < config->levels);
+                level = MIN(level + 1, config->levels - 1);
+                run.used[index] = 0;
+            }
+
+            status = mlfq_ready_push(&(run.ready), level, running);
+        }
+
+        running = NULL;
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    if(stats != NULL)
+    {
+        stats->slices = slices;
+        stats->switches = switches;
+        stats->demotions = demotions;
+        stats->boosts = run.boosts;
+        stats->preemptions = preemptions;
+    }
+
+    // Cleanup
+    mlfq_ready_free(&(run.ready));
+    event_queue_free(&(run.events));
+    free(run.used);
+    free(run.epoch);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check the levels and their quanta
+///
+/// @param[in] config The configuration
+///
+/// @return 1: Invalid; 0: Valid
+///-------------------------------------------------
+static int isInvalidConfig(const struct mlfq_config_t* config)
+{
+    if((config->levels < 1) || (config->levels > MLFQ_MAX_LEVELS) || (config->boost_interval < 0))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid configuration!\n", __func__);
+        return 1;
+    }
+
+    for(int i = 0; i < config->levels; i++)
+    {
+        if(config->quantum[i] <= 0)
+        {
+            fprintf(stderr, "%s() ERROR: Invalid quantum at level %d!\n", __func__, i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Admit every arrival at a time, then
+///         boost if one is due
+///
+/// @param[in] run The run
+/// @param[in] time Time of the events
+/// @param[in] idle Set if no task is running
+/// @param[out] boosted Set if a boost happened
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+static int handleEvents(struct mlfq_run_t* run, long long time, int idle, int* boosted)
+{
+    struct event_t event;
+
+    while(!event_queue_is_empty(&(run->events)) && (event_peek(&(run->events))->time == time))
+    {
+        event_pop(&(run->events), &event);
+
+        if(event.kind == EVENT_ARRIVAL)
+        {
+            if(mlfq_ready_push(&(run->ready), 0, &(run->task[event.index])))
+            {
+                return 1;
+            }
+
+            continue;
+        }
+
+        // The last boost can fall due after every task
+        // has finished
+        if(run->remaining == 0)
+        {
+            continue;
+        }
+
+        // NOTE: Moving the epoch on resets the time used
+        //       by every task without visiting them
+        mlfq_ready_boost(&(run->ready));
+        run->boosts++;
+        *boosted = 1;
+
+        long long interval = run->config->boost_interval;
+        long long nextBoost = time + interval;
+
+        // Boosting while no task is in the system does
+        // nothing, so skip to the first boost after the
+        // next arrival
+        if(idle && (run->ready.map == 0) && !event_queue_is_empty(&(run->events)))
+        {
+            long long arrival = event_peek(&(run->events))->time;
+
+            nextBoost = (arrival > nextBoost) ? (time + (((arrival - time + interval - 1) / interval) * interval)) : nextBoost;
+        }
+
+        event_push(&(run->events), nextBoost, EVENT_BOOST, 0);
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Time a task has run at its level since
+///         it got there or the last boost
+///
+/// @param[in] run The run
+/// @param[in] index Index of the task
+///
+/// @return The time used
+///-------------------------------------------------
+static int usedAtLevel(struct mlfq_run_t* run, int index)
+{
+    if(run->epoch[index] != run->boosts)
+    {
+        run->epoch[index] = run->boosts;
+        run->used[index] = 0;
+    }
+
+    return run->used[index];
+}
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "rr.h"
+#include "queue.h"
+
+#ifndef __MLFQ__
+#define __MLFQ__
+
+// Largest number of levels, one bit each in the ready bitmap
+#define MLFQ_MAX_LEVELS 32
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which describes the levels of a multilevel feedback queue
+//----------------------------------------------------------------------------------------------------------------------------------
+struct mlfq_config_t {
+
+    // Number of levels, 0 being the highest
+    int levels;
+
+    // Time a task may run at each level before it is moved down a level
+    int quantum[MLFQ_MAX_LEVELS];
+
+    // Time between two moves of every task back to level 0, 0 for never
+    long long boost_interval;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief FIFO queue of one level, linked through nodes of the ready list's pool
+//----------------------------------------------------------------------------------------------------------------------------------
+struct mlfq_level_t {
+
+    // First node, NULL when the level is empty
+    struct node_t* head;
+
+    // Last node, so a push doesn't walk the level
+    struct node_t* tail;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Ready list of the multilevel feedback queue: one FIFO queue of tasks per level and a
+/// bitmap of the levels which hold a task
+///
+/// @note Level l is bit (31 - l) of map, so the highest ready level is one count-leading-zeros away
+///       however many tasks are ready. Every level takes its nodes from the same pool, so a whole
+///       level can be moved onto another by relinking its ends.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct mlfq_ready_t {
+
+    // Levels whose queue isn't empty
+    uint32_t map;
+
+    // Number of levels
+    int levels;
+
+    // FIFO queue of each level
+    struct mlfq_level_t level[MLFQ_MAX_LEVELS];
+
+    // Allocator for the nodes of every level (see queue.h)
+    struct node_pool_t pool;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the counters collected during a multilevel feedback queue run
+//----------------------------------------------------------------------------------------------------------------------------------
+struct mlfq_stats_t {
+
+    // Number of slices executed; a slice cut short by an arrival or a boost counts as one
+    long long slices;
+
+    // Number of slices which ran a different task than the slice before them
+    long long switches;
+
+    // Number of times a task used up the quantum of its level and was moved down a level
+    long long demotions;
+
+    // Number of times every task was moved back to level 0
+    long long boosts;
+
+    // Number of slices cut short by a higher level arrival or a boost
+    long long preemptions;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Configure levels whose quantum doubles from one level to the next, with no boost
+///
+/// @param[in] levels The number of levels, clamped to 1..MLFQ_MAX_LEVELS
+/// @param[in] quantum The quantum of level 0
+///
+/// @return The configuration
+//----------------------------------------------------------------------------------------------------------------------------------
+struct mlfq_config_t mlfq_default_config(int levels, int quantum);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty ready list
+///
+/// @param[out] ready The ready list
+/// @param[in] levels The number of levels
+/// @param[in] capacity The number of nodes in the first chunk of the pool, the most tasks expected
+///                     to be ready at once
+//----------------------------------------------------------------------------------------------------------------------------------
+void mlfq_ready_init(struct mlfq_ready_t *ready, int levels, int capacity);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add a task to the tail of a level in O(1)
+///
+/// @param[in] ready The ready list
+/// @param[in] level The level
+/// @param[in] task The task
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int mlfq_ready_push(struct mlfq_ready_t *ready, int level, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Find the highest level holding a task in O(1)
+///
+/// @param[in] ready The ready list
+///
+/// @return the level, -1 if no task is ready
+//----------------------------------------------------------------------------------------------------------------------------------
+int mlfq_ready_highest(struct mlfq_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Remove the task at the head of the highest level in O(1)
+///
+/// @param[in] ready The ready list
+/// @param[out] level The level the task was taken from, may be NULL
+///
+/// @return the task, NULL if no task is ready
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* mlfq_ready_pop(struct mlfq_ready_t *ready, int *level);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Move every ready task to level 0 in O(levels), keeping the tasks of higher levels ahead
+/// of those of lower ones and the order within each level
+///
+/// @param[in] ready The ready list
+//----------------------------------------------------------------------------------------------------------------------------------
+void mlfq_ready_boost(struct mlfq_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the memory held by the ready list, but not the tasks
+///
+/// @param[in] ready The ready list
+//----------------------------------------------------------------------------------------------------------------------------------
+void mlfq_ready_free(struct mlfq_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the multilevel feedback queue algorithm and calculate the wait and turn around time
+/// for each task
+///
+/// @note A task arrives at level 0. The highest level holding a task runs round robin, and a task
+///       which has run for the quantum of its level in total is moved down a level (the lowest
+///       level is plain round robin). A task arriving at a higher level than the running one
+///       preempts it; the preempted task goes to the tail of its level and keeps the time it has
+///       used there. Every boost_interval, counted from time 0, every task is moved back to level 0
+///       with a fresh quantum; the running task is requeued behind the ready ones. Arrivals and
+///       boosts are kept in an event queue (see events.h), so idle gaps cost nothing and a boost
+///       costs O(levels) however many tasks are ready. With one level and no boost the times,
+///       slices and switches are the same as round_robin_events().
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] config The levels
+/// @param[in] trace Sink which receives the times of the running task after every slice, may be NULL
+/// @param[out] stats Counters collected during the run, may be NULL
+///
+/// @return 0 on success, 1 if the configuration is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int multilevel_feedback_queue(struct task_t *task, int size, const struct mlfq_config_t *config, struct trace_sink_t *trace,
+                              struct mlfq_stats_t *stats);
+
+#endif // __MLFQ__
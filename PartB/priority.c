@@ -0,0 +1,347 @@
+#include "priority.h"
+#include "events.h"
+#include "queue.h"
+#include <limits.h>
+
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+
+// Kind of the only event of the scheduler
+#define EVENT_ARRIVAL 0
+
+
+static int admitArrivals(struct event_queue_t* events, struct priority_ready_t* ready, struct task_t* task, long long time);
+
+
+///-------------------------------------------------
+/// @brief  Create an empty ready list
+///
+/// @param[out] ready The ready list
+///-------------------------------------------------
+void priority_ready_init(struct priority_ready_t* ready)
+{
+    ready->group = 0;
+
+    for(int i = 0; i < PRIORITY_WORDS; i++)
+    {
+        ready->map[i] = 0;
+    }
+
+    for(int i = 0; i < PRIORITY_LEVELS; i++)
+    {
+        ready->level[i] = NULL;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task onto its level and mark the
+///         level ready
+///
+/// @param[in] ready The ready list
+/// @param[in] task The task
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int priority_ready_push(struct priority_ready_t* ready, struct task_t* task)
+{
+    int priority = task->priority;
+
+    if((priority < 0) || (priority >= PRIORITY_LEVELS))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid priority %d!\n", __func__, priority);
+        return 1;
+    }
+
+    if(ready->level[priority] == NULL)
+    {
+        ready->level[priority] = create_empty_queue();
+
+        if(ready->level[priority] == NULL)
+        {
+            fprintf(stderr, "%s() ERROR: Couldn't create level %d!\n", __func__, priority);
+            return 1;
+        }
+    }
+
+    int size = get_queue(&(ready->level[priority]))->size;
+
+    push(&(ready->level[priority]), task);
+
+    // NOTE: push() reports a failed allocation only
+    //       by leaving the queue as it was
+    if(get_queue(&(ready->level[priority]))->size == size)
+    {
+        return 1;
+    }
+
+    ready->map[priority / 32] |= (1u << (31 - (priority % 32)));
+    ready->group |= (1u << (31 - (priority / 32)));
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Find the highest ready level with one
+///         count-leading-zeros per bitmap level
+///
+/// @param[in] ready The ready list
+///
+/// @return The level; -1: Empty
+///-------------------------------------------------
+int priority_ready_highest(struct priority_ready_t* ready)
+{
+    // NOTE: __builtin_clz() is undefined for 0
+    if(ready->group == 0)
+    {
+        return -1;
+    }
+
+    int word = __builtin_clz(ready->group);
+
+    return (word * 32) + __builtin_clz(ready->map[word]);
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the head of the highest ready level
+///         and clear its bit once it is empty
+///
+/// @param[in] ready The ready list
+///
+/// @return The task; NULL: Empty
+///-------------------------------------------------
+struct task_t* priority_ready_pop(struct priority_ready_t* ready)
+{
+    int priority = priority_ready_highest(ready);
+
+    if(priority < 0)
+    {
+        return NULL;
+    }
+
+    struct task_t* task = peek(&(ready->level[priority]));
+
+    pop(&(ready->level[priority]));
+
+    if(is_empty(&(ready->level[priority])))
+    {
+        ready->map[priority / 32] &= ~(1u << (31 - (priority % 32)));
+
+        if(ready->map[priority / 32] == 0)
+        {
+            ready->group &= ~(1u << (31 - (priority / 32)));
+        }
+    }
+
+    return task;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the queue of every level
+///
+/// @param[in] ready The ready list
+///-------------------------------------------------
+void priority_ready_free(struct priority_ready_t* ready)
+{
+    for(int i = 0; i < PRIORITY_LEVELS; i++)
+    {
+        empty_queue(&(ready->level[i]));
+    }
+
+    priority_ready_init(ready);
+}
+
+
+///-------------------------------------------------
+/// @brief  Fixed priority preemptive scheduler with
+///         round robin within each level, which
+///         runs the current slice up to the next
+///         arrival and decides again
+///
+/// @param[in] task The task queue array
+/// @param[in] quantum Length of a time slice
+/// @param[in] size Size of the task queue array
+/// @param[in] trace Sink for the times, or NULL
+/// @param[out] stats Counters of the run, or NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int priority_round_robin(struct task_t* task, int quantum, int size, struct trace_sink_t* trace, struct rr_stats_t* stats)
+{
+    struct event_queue_t events;
+    struct priority_ready_t ready;
+    struct task_t* running = NULL;
+    long long now = 0;
+    long long slices = 0;
+    long long switches = 0;
+    int sliceLeft = 0;
+    int lastTaskRan = INT_MAX;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        if((task[i].priority < 0) || (task[i].priority >= PRIORITY_LEVELS))
+        {
+            fprintf(stderr, "%s() ERROR: Invalid priority %d!\n", __func__, task[i].priority);
+            return 1;
+        }
+    }
+
+    if(event_queue_init(&events, size))
+    {
+        return 1;
+    }
+
+    priority_ready_init(&ready);
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; i < size; i++)
+    {
+        event_push(&events, task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    while(status == 0)
+    {
+        const struct event_t* next = event_peek(&events);
+
+        if(running == NULL)
+        {
+            if(ready.group != 0)
+            {
+                running = priority_ready_pop(&ready);
+            }
+            else if(next != NULL)
+            {
+                // Idle until the next arrival
+                now = next->time;
+                status = admitArrivals(&events, &ready, task, now);
+                continue;
+            }
+            else
+            {
+                break;
+            }
+
+            // Start a slice of the highest priority task
+            sliceLeft = MIN(running->left_to_execute, quantum);
+            slices++;
+
+            if(lastTaskRan != running->process_id)
+            {
+                switches += (lastTaskRan != INT_MAX);
+            }
+
+            lastTaskRan = running->process_id;
+            continue;
+        }
+
+        long long sliceEnd = now + sliceLeft;
+
+        // NOTE: A task arriving as the slice ends is
+        //       queued ahead of the requeued task
+        if((next != NULL) && (next->time <= sliceEnd))
+        {
+            // "Execute" the slice up to the arrival
+            int taskRuntime = (int)(next->time - now);
+
+            running->left_to_execute -= taskRuntime;
+            sliceLeft -= taskRuntime;
+            now = next->time;
+            status = admitArrivals(&events, &ready, task, now);
+
+            int highest = priority_ready_highest(&ready);
+
+            // NOTE: A slice which just ran out ends as usual,
+            //       so a finished task isn't preempted
+            if((status == 0) && (sliceLeft > 0) && (highest >= 0) && (highest < running->priority))
+            {
+                status = priority_ready_push(&ready, running);
+                running = NULL;
+            }
+
+            continue;
+        }
+
+        // "Execute" the rest of the slice
+        running->left_to_execute -= sliceLeft;
+        now = sliceEnd;
+        sliceLeft = 0;
+
+        // Calculate task wait time and turnaround time
+        // as of the end of its slice
+        running->turnaround_time = (int)(now - running->arrival_time);
+        running->waiting_time = running->turnaround_time - (running->execution_time - running->left_to_execute);
+
+        trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+
+        if(running->left_to_execute != 0)
+        {
+            status = priority_ready_push(&ready, running);
+        }
+        else
+        {
+            run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+        }
+
+        running = NULL;
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    if(stats != NULL)
+    {
+        stats->slices = slices;
+        stats->skipped_slices = 0;
+        stats->switches = switches;
+        stats->allocations = 0;
+        stats->overhead = 0;
+
+        for(int i = 0; i < PRIORITY_LEVELS; i++)
+        {
+            stats->allocations += (ready.level[i] != NULL) ? get_queue(&(ready.level[i]))->allocations : 0;
+        }
+    }
+
+    // Cleanup
+    priority_ready_free(&ready);
+    event_queue_free(&events);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Move every task arriving at a time onto
+///         the ready list
+///
+/// @param[in] events The pending arrivals
+/// @param[in] ready The ready list
+/// @param[in] task The task queue array
+/// @param[in] time Time of the arrivals
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+static int admitArrivals(struct event_queue_t* events, struct priority_ready_t* ready, struct task_t* task, long long time)
+{
+    struct event_t event;
+
+    while(!event_queue_is_empty(events) && (event_peek(events)->time == time))
+    {
+        event_pop(events, &event);
+
+        if(priority_ready_push(ready, &(task[event.index])))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
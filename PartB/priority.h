@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "rr.h"
+
+#ifndef __PRIORITY__
+#define __PRIORITY__
+
+// Number of priority levels, 0 being the highest
+#define PRIORITY_LEVELS 256
+
+// Number of 32-bit words in the ready bitmap
+#define PRIORITY_WORDS (PRIORITY_LEVELS / 32)
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Ready list of a fixed priority scheduler: one FIFO queue of tasks per priority level and a
+/// two-level bitmap of the levels which hold a task
+///
+/// @note Level p is bit (31 - p % 32) of map[p / 32], and word w is bit (31 - w) of group, so the
+///       highest ready level is two count-leading-zeros away however many tasks are ready.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct priority_ready_t {
+
+    // Words of map which have a bit set
+    uint32_t group;
+
+    // Levels whose queue isn't empty
+    uint32_t map[PRIORITY_WORDS];
+
+    // FIFO queue of each level (see queue.h), created the first time a task is pushed onto it
+    struct node_t* level[PRIORITY_LEVELS];
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty ready list
+///
+/// @param[out] ready The ready list
+//----------------------------------------------------------------------------------------------------------------------------------
+void priority_ready_init(struct priority_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add a task to the tail of the queue of its priority level in O(1)
+///
+/// @param[in] ready The ready list
+/// @param[in] task The task
+///
+/// @return 0 on success, 1 if the priority is out of range or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int priority_ready_push(struct priority_ready_t *ready, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Find the highest priority level holding a task in O(1)
+///
+/// @param[in] ready The ready list
+///
+/// @return the level, -1 if no task is ready
+//----------------------------------------------------------------------------------------------------------------------------------
+int priority_ready_highest(struct priority_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Remove the task at the head of the highest priority level in O(1)
+///
+/// @param[in] ready The ready list
+///
+/// @return the task, NULL if no task is ready
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* priority_ready_pop(struct priority_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the memory held by the ready list, but not the tasks
+///
+/// @param[in] ready The ready list
+//----------------------------------------------------------------------------------------------------------------------------------
+void priority_ready_free(struct priority_ready_t *ready);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the fixed priority preemptive algorithm, with round robin among tasks of the same
+/// priority, and calculate the wait and turn around time for each task
+///
+/// @note The highest priority ready task runs for a slice of up to one quantum, and then goes to
+///       the tail of its level the same way round_robin() requeues it. A task which arrives with a
+///       higher priority than the running one preempts it at once; the preempted task goes to the
+///       tail of its level and gets a whole quantum when it runs again. Arrivals are kept in an
+///       event queue (see events.h), so idle gaps cost nothing. With every task at the same
+///       priority and arriving at 0, the times, slices and switches are the same as round_robin().
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+/// @param[in] trace Sink which receives the times of the running task after every slice, may be NULL
+/// @param[out] stats Counters collected during the run, may be NULL; a preempted slice counts as one
+///
+/// @return 0 on success, 1 if a priority is out of range or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int priority_round_robin(struct task_t *task, int quantum, int size, struct trace_sink_t *trace, struct rr_stats_t *stats);
+
+#endif // __PRIORITY__
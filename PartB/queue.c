@@ -1,7 +1,12 @@
 #include "queue.h"
 
 
-static int isSentinel(struct node_t* head);
+#define POOL_CHUNK_SIZE 1024
+
+
+static struct node_t* unlinkTopNode(struct queue_t* queue);
+static int isSentinel(struct node_t* node);
+static struct node_t* createQueueHandle(int capacity);
 static int isInvalidNode(struct node_t* node, const char* caller);
 
 
@@ -24,8 +29,10 @@ struct node_t* create_queue(struct task_t* task, int size)
         return NULL;
     }
 
-    // Create the sentinel node at the base of the queue
-    struct node_t* sentinel = create_new_node(NULL);
+    // Create the queue handle, which holds the sentinel
+    // NOTE: Size the first chunk of the node pool so
+    //       every task node is contiguous
+    struct node_t* sentinel = createQueueHandle(size);
 
     // Verify that malloc didn't fail
     if(isInvalidNode(sentinel, __func__))
@@ -33,34 +40,55 @@ struct node_t* create_queue(struct task_t* task, int size)
         return NULL;
     }
 
-    struct node_t* currentNode = sentinel;
-
     // Create and link nodes together to form the queue
     // NOTE: The first "true" node in the queue is linked to the sentinel
     for(int i = 0; i < size; i++)
     {
-        // Create a new node
-        currentNode->next = create_new_node(&(task[i]));
+        push(&sentinel, &(task[i]));
+    }
 
-        // Verify that malloc didn't fail
-        if(isInvalidNode(currentNode->next, __func__))
-        {
-            return NULL;
-        }
+    return sentinel;
+}
 
-        // Traverse to next node
-        currentNode = currentNode->next;
 
-        // Check if this is the last node
-        if(i == (size - 1))
-        {
-            // Complete circular queue by linking
-            // last node to the sentinel
-            currentNode->next = sentinel;
-        }
-    }
+///-------------------------------------------------
+/// @brief  Construct a queue handle with no task
+///         nodes
+///
+/// @return The sentinel node of the queue
+///-------------------------------------------------
+struct node_t* create_empty_queue(void)
+{
+    return createQueueHandle(POOL_CHUNK_SIZE);
+}
 
-    return sentinel;
+
+///-------------------------------------------------
+/// @brief  Get the handle that owns a queue
+///
+/// @param[in] head The head of the task queue
+///
+/// @return The queue handle
+///-------------------------------------------------
+struct queue_t* get_queue(struct node_t** head)
+{
+    // NOTE: The sentinel is the first member of
+    //       the handle, so they share an address
+    return (struct queue_t*)(*head);
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the number of task nodes in the
+///         queue
+///
+/// @param[in] head The head of the task queue
+///
+/// @return The number of task nodes
+///-------------------------------------------------
+int queue_size(struct node_t** head)
+{
+    return get_queue(head)->size;
 }
 
 
@@ -75,7 +103,7 @@ struct node_t* create_new_node(struct task_t* task)
 {
     // Dynamically allocate memory for the new node
     struct node_t* newNode = (struct node_t*)malloc(sizeof(struct node_t));
-    
+
     // Verify that malloc didn't fail
     if(isInvalidNode(newNode, __func__))
     {
@@ -90,11 +118,120 @@ struct node_t* create_new_node(struct task_t* task)
 }
 
 
+///-------------------------------------------------
+/// @brief  Initialize a node pool without
+///         allocating any chunk yet
+///
+/// @param[in] pool The pool to initialize
+/// @param[in] chunk_size Nodes in the first chunk
+///-------------------------------------------------
+void pool_init(struct node_pool_t* pool, int chunk_size)
+{
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->used = 0;
+    pool->chunk_size = (chunk_size > 0) ? chunk_size : POOL_CHUNK_SIZE;
+}
+
+
+///-------------------------------------------------
+/// @brief  Take a node from the pool, preferring
+///         previously freed nodes
+///
+/// @param[in] pool The pool
+/// @param[in] task Task to attach to the node
+///
+/// @return The node, NULL if malloc failed
+///-------------------------------------------------
+struct node_t* pool_alloc(struct node_pool_t* pool, struct task_t* task)
+{
+    struct node_t* newNode = pool->free_list;
+
+    if(newNode != NULL)
+    {
+        // Reuse a freed node
+        pool->free_list = newNode->next;
+    }
+    else
+    {
+        // Allocate a new chunk once the newest one is
+        // used up
+        if((pool->chunks == NULL) || (pool->used == pool->chunks->capacity))
+        {
+            struct node_chunk_t* chunk = (struct node_chunk_t*)malloc(sizeof(struct node_chunk_t) +
+                                                                      (pool->chunk_size * sizeof(struct node_t)));
+
+            if(chunk == NULL)
+            {
+                fprintf(stderr, "%s() ERROR: Couldn't create chunk!\n", __func__);
+                return NULL;
+            }
+
+            chunk->capacity = pool->chunk_size;
+            chunk->next = pool->chunks;
+            pool->chunks = chunk;
+            pool->used = 0;
+
+            // NOTE: Only the first chunk is sized by the
+            //       caller; the rest cover requeues
+            pool->chunk_size = POOL_CHUNK_SIZE;
+        }
+
+        // Carve the next node out of the newest chunk
+        newNode = &(pool->chunks->nodes[pool->used]);
+        pool->used++;
+    }
+
+    // Initialize node data members
+    newNode->task = task;
+    newNode->next = NULL;
+
+    return newNode;
+}
+
+
+///-------------------------------------------------
+/// @brief  Give a node back to the pool
+///
+/// @param[in] pool The pool the node came from
+/// @param[in] node The node to reuse later
+///-------------------------------------------------
+void pool_free(struct node_pool_t* pool, struct node_t* node)
+{
+    node->task = NULL;
+    node->next = pool->free_list;
+    pool->free_list = node;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free every chunk of the pool at once
+///
+/// @param[in] pool The pool to release
+///-------------------------------------------------
+void pool_release(struct node_pool_t* pool)
+{
+    struct node_chunk_t* chunk = pool->chunks;
+    struct node_chunk_t* nextChunk;
+
+    while(chunk != NULL)
+    {
+        nextChunk = chunk->next;
+        free(chunk);
+        chunk = nextChunk;
+    }
+
+    pool->chunks = NULL;
+    pool->free_list = NULL;
+    pool->used = 0;
+}
+
+
 ///-------------------------------------------------
 /// @brief Returns the top-most task for the queue
 ///
 /// @param[in] head The head of the task queue
-/// 
+///
 /// @return The top-most task
 ///-------------------------------------------------
 struct task_t* peek(struct node_t** head)
@@ -127,22 +264,32 @@ void pop(struct node_t** head)
         return;
     }
 
-    struct node_t* sentinel = (*head);
-    struct node_t* nodeToPop = sentinel->next;
-    struct node_t* newTopNode = nodeToPop->next;
+    struct queue_t* queue = get_queue(head);
 
-    // Pop the top-most task node from the queue
-    sentinel->next = newTopNode;
-    free(nodeToPop);
+    // Give the popped node back to the pool
+    pool_free(&(queue->pool), unlinkTopNode(queue));
+    queue->allocations++;
+}
 
-    // Check if the sentinel is pointing to itself
-    // NOTE: This would occur if only one task node is
-    //       in the queue when pop() is called
-    if(sentinel->next == sentinel)
+
+///-------------------------------------------------
+/// @brief  Pop the top-most task off the queue
+///         without giving its node back to the
+///         pool
+///
+/// @param[in] head The head of the queue
+///-------------------------------------------------
+void retire(struct node_t** head)
+{
+    // Check if the queue is invalid or empty
+    if(isInvalidNode(*head, __func__) || is_empty(head))
     {
-        // Update the sentinel to signify an empty queue
-        sentinel->next = NULL;
+        return;
     }
+
+    // NOTE: The node stays out of the free list, so it
+    //       is only released along with the pool
+    unlinkTopNode(get_queue(head));
 }
 
 
@@ -154,46 +301,65 @@ void pop(struct node_t** head)
 ///-------------------------------------------------
 void push(struct node_t** head, struct task_t* task)
 {
-    // Validate parameters
+    // Verify that the queue is initialized properly
     if(isInvalidNode(*head, __func__) || (task == NULL))
     {
         return;
     }
 
-    struct node_t* sentinel = *head;
+    struct queue_t* queue = get_queue(head);
+    struct node_t* newNode = pool_alloc(&(queue->pool), task);
 
-    // Check if the queue is empty
-    if(is_empty(&sentinel))
+    // Verify that malloc didn't fail
+    if(isInvalidNode(newNode, __func__))
     {
-        // Push the node onto the end of the queue
-        struct node_t* newNode = sentinel->next;
-        newNode = create_new_node(task);
-
-        // Complete circular linkage
-        newNode->next = sentinel;
+        return;
     }
-    else
-    {
-        struct node_t* nextNode = sentinel->next;
-        struct node_t* currentNode;
 
-        // Traverse queue until you find the sentinel
-        while(!isSentinel(nextNode))
-        {
-            currentNode = nextNode;
-            nextNode = nextNode->next;
-        }
+    // Insert new node at the end of the task queue
+    // NOTE: When the queue is empty the tail is the
+    //       sentinel, so this also links the first
+    //       task node to the sentinel
+    queue->tail->next = newNode;
+    queue->tail = newNode;
+    queue->size++;
+    queue->allocations++;
+
+    // Update the end of the queue to point back to
+    // the sentinel (completing circular linkage)
+    newNode->next = &(queue->sentinel);
+}
 
-        // Insert new node at the end of the task queue
-        struct node_t* newNode = create_new_node(task);
-        currentNode->next = newNode;
 
-        // Update the end of the queue to point back to
-        // the sentinel (completing circular linkage)
-        newNode->next = sentinel;
+///-------------------------------------------------
+/// @brief  Move the top-most task node to the end
+///         of the queue by relinking it
+///
+/// @param[in] head The head of the task queue
+///-------------------------------------------------
+void rotate(struct node_t** head)
+{
+    // Check if the queue is invalid or too short
+    // for the order to change
+    if(isInvalidNode(*head, __func__) || (queue_size(head) < 2))
+    {
+        return;
     }
+
+    struct queue_t* queue = get_queue(head);
+    struct node_t* nodeToMove = queue->sentinel.next;
+
+    // Unlink the top-most task node from the sentinel
+    queue->sentinel.next = nodeToMove->next;
+
+    // Relink it after the tail, completing the
+    // circular linkage back to the sentinel
+    queue->tail->next = nodeToMove;
+    nodeToMove->next = &(queue->sentinel);
+    queue->tail = nodeToMove;
 }
 
+
 ///-------------------------------------------------
 /// @brief  Check if the queue is empty
 ///
@@ -208,31 +374,58 @@ int is_empty(struct node_t** head)
 
 
 ///-------------------------------------------------
-/// @brief  Traverse the queue and free all memory
-///         aside from the the sentinel
+/// @brief  Free all memory held by the queue,
+///         including the queue handle
 ///
 /// @param[in] head The head of the queue to empty
 ///-------------------------------------------------
 void empty_queue(struct node_t** head)
 {
-    // Check if queue is empty or uninitialized
-    if(is_empty(head))
+    // Check if queue is uninitialized
+    if(*head == NULL)
     {
         return;
     }
 
-    struct node_t* currentNode = *head;
-    struct node_t* nextNode;
+    // Free every task node at once, including the
+    // retired ones
+    pool_release(&(get_queue(head)->pool));
+
+    // Free the handle, which holds the sentinel
+    free(get_queue(head));
+
+    *head = NULL;
+}
 
-    // Traverse the queue and free each node
-    while(currentNode != NULL)
+
+///-------------------------------------------------
+/// @brief  Unlink the top-most task node from the
+///         sentinel
+///
+/// @param[in] queue The queue handle, which must
+///                  not be empty
+///
+/// @return The unlinked node
+///-------------------------------------------------
+static struct node_t* unlinkTopNode(struct queue_t* queue)
+{
+    struct node_t* topNode = queue->sentinel.next;
+
+    queue->sentinel.next = topNode->next;
+    queue->size--;
+
+    // Check if the sentinel is pointing to itself
+    // NOTE: This would occur if only one task node is
+    //       in the queue when it is unlinked
+    if(isSentinel(queue->sentinel.next))
     {
-        nextNode = currentNode->next;
-        free(currentNode);
-        currentNode = nextNode;
+        // Update the sentinel to signify an empty queue
+        // and fall the tail back to the sentinel
+        queue->sentinel.next = NULL;
+        queue->tail = &(queue->sentinel);
     }
 
-    *head = NULL;
+    return topNode;
 }
 
 
@@ -249,6 +442,38 @@ static int isSentinel(struct node_t* node)
 }
 
 
+///-------------------------------------------------
+/// @brief  Construct a queue handle with an empty
+///         node pool
+///
+/// @param[in] capacity Number of nodes in the
+///                     first chunk of the pool
+///
+/// @return The sentinel node of the queue
+///-------------------------------------------------
+static struct node_t* createQueueHandle(int capacity)
+{
+    // Dynamically allocate memory for the handle
+    struct queue_t* queue = (struct queue_t*)malloc(sizeof(struct queue_t));
+
+    if(queue == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create queue!\n", __func__);
+        return NULL;
+    }
+
+    // An empty queue's tail is its sentinel
+    queue->sentinel.task = NULL;
+    queue->sentinel.next = NULL;
+    queue->tail = &(queue->sentinel);
+    queue->size = 0;
+    queue->allocations = 0;
+    pool_init(&(queue->pool), capacity);
+
+    return &(queue->sentinel);
+}
+
+
 ///-------------------------------------------------
 /// @brief  Validates that a node was constructed
 ///
@@ -266,4 +491,4 @@ static int isInvalidNode(struct node_t* node, const char* caller)
     }
 
     return 0;
-}
\ No newline at end of file
+}
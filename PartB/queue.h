@@ -16,6 +16,66 @@ struct node_t {
     struct node_t* next;
 };
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Contiguous block of nodes handed out by a node pool
+//----------------------------------------------------------------------------------------------------------------------------------
+struct node_chunk_t {
+    // Previously allocated chunk
+    struct node_chunk_t* next;
+
+    // Number of nodes in this chunk
+    int capacity;
+
+    // The nodes themselves
+    struct node_t nodes[];
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Slab allocator for queue nodes
+///
+/// @note Nodes are carved out of large chunks in order and freed nodes are kept on a free list for
+///       reuse, so only a new chunk costs a malloc. pool_release() frees every chunk in one call
+///       regardless of which nodes are still in use.
+//----------------------------------------------------------------------------------------------------------------------------------
+struct node_pool_t {
+    // Chunks allocated so far, newest first
+    struct node_chunk_t* chunks;
+
+    // Nodes given back by pool_free(), linked through their next pointers
+    struct node_t* free_list;
+
+    // Number of nodes already carved out of the newest chunk
+    int used;
+
+    // Number of nodes in the next chunk to be allocated
+    int chunk_size;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Handle which owns the queue's sentinel and tracks its tail so that
+/// push, pop and peek are all constant time
+///
+/// @note The sentinel is the first member, so the node_t* returned by create_queue()
+///       is also the address of its handle (see get_queue())
+//----------------------------------------------------------------------------------------------------------------------------------
+struct queue_t {
+    // Sentinel node; sentinel.next is the top of the queue
+    struct node_t sentinel;
+
+    // Last task node in the queue (the sentinel when the queue is empty)
+    struct node_t* tail;
+
+    // Number of task nodes currently in the queue
+    int size;
+
+    // Allocator for the task nodes
+    struct node_pool_t pool;
+
+    // Number of nodes taken from the pool by push() and given back by pop() since the queue was
+    // created
+    long long allocations;
+};
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Creates a queue.
 ///
@@ -26,15 +86,75 @@ struct node_t {
 //----------------------------------------------------------------------------------------------------------------------------------
 struct node_t* create_queue(struct task_t* task, int size);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Creates a queue with no task nodes
+///
+/// @return the head of the new queue
+//----------------------------------------------------------------------------------------------------------------------------------
+struct node_t* create_empty_queue(void);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Returns the handle which owns the queue
+///
+/// @param head The head of a queue returned by create_queue() or create_empty_queue()
+///
+/// @return the queue handle
+//----------------------------------------------------------------------------------------------------------------------------------
+struct queue_t* get_queue(struct node_t** head);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Returns the number of task nodes in the queue
+///
+/// @param head The head of the queue
+///
+/// @return the number of task nodes in the queue
+//----------------------------------------------------------------------------------------------------------------------------------
+int queue_size(struct node_t** head);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Create a new node for the queue
 ///
+/// @note Queues take their nodes from their own node pool; this allocates a standalone node
+///
 /// @param task The task information
 ///
 /// @return a newly allocated task
 //----------------------------------------------------------------------------------------------------------------------------------
 struct node_t* create_new_node(struct task_t* task);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Initialize an empty node pool
+///
+/// @param pool The pool to initialize
+/// @param chunk_size Number of nodes in the first chunk
+//----------------------------------------------------------------------------------------------------------------------------------
+void pool_init(struct node_pool_t* pool, int chunk_size);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Take a node from the pool
+///
+/// @param pool The pool
+/// @param task The task information
+///
+/// @return a node holding the task, NULL if a new chunk couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+struct node_t* pool_alloc(struct node_pool_t* pool, struct task_t* task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Give a node back to the pool for reuse
+///
+/// @param pool The pool the node was taken from
+/// @param node The node
+//----------------------------------------------------------------------------------------------------------------------------------
+void pool_free(struct node_pool_t* pool, struct node_t* node);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Free every chunk of the pool, including nodes which were never given back
+///
+/// @param pool The pool
+//----------------------------------------------------------------------------------------------------------------------------------
+void pool_release(struct node_pool_t* pool);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Returns the top node in the queue
 ///
@@ -59,6 +179,21 @@ void pop(struct node_t** head);
 //----------------------------------------------------------------------------------------------------------------------------------
 void push(struct node_t** head, struct task_t* task);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Move the top node of the queue to the end of it without allocating or freeing
+///
+/// @param head The head of the queue
+//----------------------------------------------------------------------------------------------------------------------------------
+void rotate(struct node_t** head);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Removes the element at the top of the queue without giving its node back to the pool.
+/// The node is released with the pool by empty_queue().
+///
+/// @param head The head of the queue.
+//----------------------------------------------------------------------------------------------------------------------------------
+void retire(struct node_t** head);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Determines whether the specified head is empty.
 ///
@@ -69,9 +204,9 @@ void push(struct node_t** head, struct task_t* task);
 int is_empty(struct node_t** head);
 
 //----------------------------------------------------------------------------------------------------------------------------------
-/// @brief Remove all items from the queue
+/// @brief Remove all items from the queue and release the queue itself
 ///
-/// @param head The head of the queue
+/// @param head The head of the queue, set to NULL on return
 //----------------------------------------------------------------------------------------------------------------------------------
 void empty_queue(struct node_t** head);
 
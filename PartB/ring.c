@@ -0,0 +1,262 @@
+#include "ring.h"
+
+
+#define RING_MIN_CAPACITY 16
+
+
+static unsigned int roundUpToPowerOfTwo(unsigned int value);
+static int growRing(struct ring_t* ring);
+
+
+///-------------------------------------------------
+/// @brief  Initialize an empty ring with room for
+///         at least the given number of tasks
+///
+/// @param[out] ring The ring to initialize
+/// @param[in] capacity Minimum number of tasks
+///
+/// @return 0: Success; 1: Allocation failed
+///-------------------------------------------------
+int ring_init(struct ring_t* ring, int capacity)
+{
+    unsigned int slots = RING_MIN_CAPACITY;
+
+    if(capacity > RING_MIN_CAPACITY)
+    {
+        slots = roundUpToPowerOfTwo((unsigned int)capacity);
+    }
+
+    ring->buffer = (struct task_t**)malloc(slots * sizeof(struct task_t*));
+    ring->mask = slots - 1;
+    ring->head = 0;
+    ring->count = 0;
+    ring->allocations = 0;
+
+    // Verify that malloc didn't fail
+    if(ring->buffer == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create ring!\n", __func__);
+        ring->mask = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Given an array of tasks, construct a
+///         ring holding each task in order
+///
+/// @param[out] ring The ring to initialize
+/// @param[in] task Array of tasks
+/// @param[in] size The number of tasks
+///
+/// @return 0: Success; 1: Allocation failed
+///-------------------------------------------------
+int ring_create(struct ring_t* ring, struct task_t* task, int size)
+{
+    if(ring_init(ring, size))
+    {
+        return 1;
+    }
+
+    // NOTE: The ring was sized to hold every task,
+    //       so they can be copied straight in
+    for(int i = 0; i < size; i++)
+    {
+        ring->buffer[i] = &(task[i]);
+    }
+
+    ring->count = (size > 0) ? (unsigned int)size : 0;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Refill a ring with each task in order,
+///         keeping its buffer if it fits
+///
+/// @param[in] ring The ring
+/// @param[in] task Array of tasks
+/// @param[in] size The number of tasks
+///
+/// @return 0: Success; 1: Allocation failed
+///-------------------------------------------------
+int ring_refill(struct ring_t* ring, struct task_t* task, int size)
+{
+    if((ring->buffer == NULL) || ((unsigned int)size > ring->mask + 1))
+    {
+        long long allocations = ring->allocations;
+
+        ring_free(ring);
+
+        if(ring_create(ring, task, size))
+        {
+            return 1;
+        }
+
+        ring->allocations = allocations + 1;
+
+        return 0;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        ring->buffer[i] = &(task[i]);
+    }
+
+    ring->head = 0;
+    ring->count = (size > 0) ? (unsigned int)size : 0;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task onto the end of the ring
+///
+/// @param[in] ring The ring
+/// @param[in] task The task to push onto the ring
+///
+/// @return 0: Success; 1: Couldn't grow the ring
+///-------------------------------------------------
+int ring_push(struct ring_t* ring, struct task_t* task)
+{
+    // Double the capacity when the ring is full, or
+    // allocate it again once the ring was freed
+    if(((ring->buffer == NULL) || (ring->count > ring->mask)) && growRing(ring))
+    {
+        return 1;
+    }
+
+    ring->buffer[(ring->head + ring->count) & ring->mask] = task;
+    ring->count++;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief Returns the top-most task of the ring
+///
+/// @param[in] ring The ring
+///
+/// @return The top-most task
+///-------------------------------------------------
+struct task_t* ring_peek(struct ring_t* ring)
+{
+    if(ring_is_empty(ring))
+    {
+        return NULL;
+    }
+
+    return ring->buffer[ring->head];
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the top-most task off the ring
+///
+/// @param[in] ring The ring
+///-------------------------------------------------
+void ring_pop(struct ring_t* ring)
+{
+    if(ring_is_empty(ring))
+    {
+        return;
+    }
+
+    ring->head = (ring->head + 1) & ring->mask;
+    ring->count--;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check if the ring is empty
+///
+/// @param[in] ring The ring
+///
+/// @return True/False
+///-------------------------------------------------
+int ring_is_empty(struct ring_t* ring)
+{
+    return (ring->count == 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the ring's buffer
+///
+/// @param[in] ring The ring
+///-------------------------------------------------
+void ring_free(struct ring_t* ring)
+{
+    free(ring->buffer);
+
+    ring->buffer = NULL;
+    ring->mask = 0;
+    ring->head = 0;
+    ring->count = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Round a value up to the next power of
+///         two
+///
+/// @param[in] value The value to round
+///
+/// @return The smallest power of two >= value
+///-------------------------------------------------
+static unsigned int roundUpToPowerOfTwo(unsigned int value)
+{
+    unsigned int power = 1;
+
+    while(power < value)
+    {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+
+///-------------------------------------------------
+/// @brief  Double the ring's capacity, unwrapping
+///         its contents to the start of the new
+///         buffer; a ring without a buffer gets
+///         the smallest one
+///
+/// @param[in] ring The ring to grow
+///
+/// @return 0: Success; 1: Allocation failed
+///-------------------------------------------------
+static int growRing(struct ring_t* ring)
+{
+    unsigned int slots = (ring->buffer == NULL) ? RING_MIN_CAPACITY : (2 * (ring->mask + 1));
+    struct task_t** buffer = (struct task_t**)malloc(slots * sizeof(struct task_t*));
+
+    // Verify that malloc didn't fail
+    if(buffer == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't grow ring!\n", __func__);
+        return 1;
+    }
+
+    // Copy the tasks in queue order
+    for(unsigned int i = 0; i < ring->count; i++)
+    {
+        buffer[i] = ring->buffer[(ring->head + i) & ring->mask];
+    }
+
+    free(ring->buffer);
+
+    ring->buffer = buffer;
+    ring->mask = slots - 1;
+    ring->head = 0;
+    ring->allocations++;
+
+    return 0;
+}
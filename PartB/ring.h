@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __RING__
+#define __RING__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Array-backed ready queue which stores task pointers in a contiguous ring buffer
+///
+/// @note The capacity is always a power of two so indices wrap with a mask instead of a modulo
+//----------------------------------------------------------------------------------------------------------------------------------
+struct ring_t {
+    // Contiguous buffer of task pointers
+    struct task_t** buffer;
+
+    // Capacity of the buffer minus one
+    unsigned int mask;
+
+    // Index of the top-most task
+    unsigned int head;
+
+    // Number of tasks currently in the ring
+    unsigned int count;
+
+    // Number of times the buffer was reallocated to grow
+    long long allocations;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Initialize an empty ring
+///
+/// @param[out] ring The ring to initialize
+/// @param[in] capacity The minimum number of tasks the ring holds before it has to grow
+///
+/// @return 0 on success, 1 if the buffer couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int ring_init(struct ring_t* ring, int capacity);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create a ring holding every task of the task array, in order
+///
+/// @param[out] ring The ring to initialize
+/// @param[in] task The task information
+/// @param[in] size The size of the task array
+///
+/// @return 0 on success, 1 if the buffer couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int ring_create(struct ring_t* ring, struct task_t* task, int size);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Empty a ring and refill it with every task of the task array, in order, reusing its
+/// buffer unless it is too small
+///
+/// @param[in] ring The ring, initialized or freed
+/// @param[in] task The task information
+/// @param[in] size The size of the task array
+///
+/// @return 0 on success, 1 if the buffer couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int ring_refill(struct ring_t* ring, struct task_t* task, int size);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Push a task onto the end of the ring, doubling the capacity if it is full (a freed ring
+/// gets a new buffer)
+///
+/// @param ring The ring
+/// @param task The task to be put into the ring
+///
+/// @return 0 on success, 1 if the ring couldn't grow
+//----------------------------------------------------------------------------------------------------------------------------------
+int ring_push(struct ring_t* ring, struct task_t* task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Returns the top task in the ring
+///
+/// @param ring The ring
+///
+/// @return the task at the top of the ring, NULL if it is empty
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* ring_peek(struct ring_t* ring);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Removes the task at the top of the ring
+///
+/// @param ring The ring
+//----------------------------------------------------------------------------------------------------------------------------------
+void ring_pop(struct ring_t* ring);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Determines whether the ring is empty
+///
+/// @param ring The ring
+///
+/// @return True if the ring is empty, False otherwise
+//----------------------------------------------------------------------------------------------------------------------------------
+int ring_is_empty(struct ring_t* ring);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the ring's buffer
+///
+/// @param ring The ring
+//----------------------------------------------------------------------------------------------------------------------------------
+void ring_free(struct ring_t* ring);
+
+#endif // __RING__
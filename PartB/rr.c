@@ -1,12 +1,75 @@
 #include "rr.h"
+#include "events.h"
 #include "queue.h"
+#include "ring.h"
+#include "intake.h"
 #include <limits.h>
+#include <sched.h>
 #include <stdio.h>
 
 
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
 
+// Kinds of event of the event-driven scheduler
+#define EVENT_ARRIVAL 0
+#define EVENT_SLICE_END 1
+
+
+///-------------------------------------------------
+/// @brief  Ready queue of the scheduler, held by
+///         whichever backend was configured
+///-------------------------------------------------
+struct ready_queue_t {
+    // Backend which holds the tasks
+    enum rr_ready_queue_t backend;
+
+    // Relink nodes instead of push()/pop(), so the
+    // linked backend never allocates or frees
+    int rotate;
+
+    // Sentinel of the linked queue (RR_READY_LINKED)
+    struct node_t* list;
+
+    // Ring buffer of tasks (RR_READY_RING)
+    struct ring_t ring;
+
+    // Caller's ring the buffer is borrowed from, or
+    // NULL if the ready queue owns it
+    struct ring_t* arena;
+};
+
+
+///-------------------------------------------------
+/// @brief  Position of a walk over the ready queue
+///         in queue order
+///-------------------------------------------------
+struct ready_cursor_t {
+    // Current node (RR_READY_LINKED)
+    struct node_t* node;
+
+    // Offset from the top of the ring (RR_READY_RING)
+    unsigned int offset;
+};
+
+
+static int createReadyQueue(struct ready_queue_t* ready, struct task_t* task, int size);
+static int readyIsEmpty(struct ready_queue_t* ready);
+static int readyCount(struct ready_queue_t* ready);
+static struct task_t* readyFirst(struct ready_queue_t* ready, struct ready_cursor_t* cursor);
+static struct task_t* readyNext(struct ready_queue_t* ready, struct ready_cursor_t* cursor);
+static struct task_t* readyPeek(struct ready_queue_t* ready);
+static void readyRequeue(struct ready_queue_t* ready);
+static void readyPop(struct ready_queue_t* ready);
+static long long readyAllocations(struct ready_queue_t* ready);
+static void freeReadyQueue(struct ready_queue_t* ready);
+static long long skipRounds(struct ready_queue_t* ready, int rounds, int quantum, int switchCost, int* runTime,
+                            long long* overhead, struct trace_sink_t* trace);
+static int switchOverhead(const struct rr_config_t* config, struct task_t* task, int runTime);
+static int queueTask(struct node_t** queue, struct task_t* task);
+static int drainIntake(struct intake_queue_t* intake, struct node_t** queue, long long now, int limit);
+
+
 void init(struct task_t *task, int *execution, int size)
 {
     for(int i = 0; i < size; i++)
@@ -16,30 +79,134 @@ void init(struct task_t *task, int *execution, int size)
         task[i].left_to_execute = execution[i];
         task[i].waiting_time = 0;
         task[i].turnaround_time = 0;
+        task[i].arrival_time = 0;
+        task[i].priority = 0;
+        task[i].period = 0;
+        task[i].deadline = 0;
     }
 }
 
 
 void round_robin(struct task_t *task, int quantum, int size)
+{
+    struct rr_config_t config = rr_default_config();
+    struct trace_sink_t console;
+
+    // Print times to console
+    trace_open(&console, TRACE_TEXT, stdout);
+    config.trace = &console;
+
+    round_robin_with_config(task, quantum, size, &config, NULL);
+    trace_close(&console);
+}
+
+
+struct rr_config_t rr_default_config(void)
+{
+    struct rr_config_t config;
+
+    config.ready_queue = RR_READY_LINKED;
+    config.rotate_requeue = 0;
+    config.skip_rounds = 0;
+    config.trace = NULL;
+    config.arena = NULL;
+    config.switch_cost = 0;
+    config.refill_cost = 0;
+    config.refill_window = 0;
+
+    return config;
+}
+
+
+void round_robin_with_config(struct task_t *task, int quantum, int size, const struct rr_config_t *config,
+                             struct rr_stats_t *stats)
 {
     int runTime = 0;
     int taskRuntime = 0;
     int lastTaskRan = INT_MAX;
+    long long slices = 0;
+    long long skippedSlices = 0;
+    long long switches = 0;
+    long long overhead = 0;
+    long long allocationsAtStart;
+    struct run_metrics_t metrics;
+
+    // Slices left in the current round, and the least
+    // time left by any task requeued during it
+    int roundRemaining = size;
+    int minLeft = INT_MAX;
+
+    struct rr_config_t defaultConfig = rr_default_config();
+    struct ready_queue_t ready;
+
+    // NOTE: Skipping rounds divides by the quantum
+    if(quantum < 1)
+    {
+        fprintf(stderr, "%s() ERROR: Quantum must be at least 1!\n", __func__);
+        return;
+    }
+
+    if(config == NULL)
+    {
+        config = &defaultConfig;
+    }
 
     // Create queue based on the task array
-    struct node_t* queue = create_queue(task, size);
+    ready.backend = config->ready_queue;
+    ready.rotate = config->rotate_requeue;
+    ready.arena = config->arena;
+
+    if(createReadyQueue(&ready, task, size))
+    {
+        return;
+    }
+
+    // Only count the allocations made while scheduling
+    allocationsAtStart = readyAllocations(&ready);
+    trace_begin(config->trace, &metrics);
 
     // Execute the round robin algorithm
-    while(!is_empty(&queue))
+    while(!readyIsEmpty(&ready))
     {
+        // At the start of a round every ready task was
+        // requeued during the previous one
+        if(roundRemaining == 0)
+        {
+            // NOTE: Skip only as many rounds as leave every
+            //       task unfinished, so none of them can
+            //       leave the queue and change its order
+            if(config->skip_rounds && (minLeft > quantum) && !((config->refill_cost > 0) && (config->refill_window > 0)))
+            {
+                long long skipped = skipRounds(&ready, (minLeft - 1) / quantum, quantum, config->switch_cost, &runTime,
+                                               &overhead, config->trace);
+
+                // NOTE: Only a lone task runs twice in a row
+                switches += (readyCount(&ready) > 1) ? skipped : 0;
+                skippedSlices += skipped;
+            }
+
+            roundRemaining = readyCount(&ready);
+            minLeft = INT_MAX;
+        }
+
         // "Execute" the first task
-        struct task_t* currentTask = peek(&queue);
+        struct task_t* currentTask = readyPeek(&ready);
+
+        // Charge the switch to it before it runs
+        if((lastTaskRan != INT_MAX) && (lastTaskRan != currentTask->process_id))
+        {
+            int cost = switchOverhead(config, currentTask, runTime);
+
+            runTime += cost;
+            overhead += cost;
+        }
 
         taskRuntime = MIN(currentTask->left_to_execute, quantum);
         currentTask->left_to_execute -= taskRuntime;
         
         // Update runtime
         runTime += taskRuntime;
+        slices++;
 
         // Calculate task wait time and turnaround time
         // NOTE: If the same task runs twice in a row
@@ -47,6 +214,7 @@ void round_robin(struct task_t *task, int quantum, int size)
         if(lastTaskRan != currentTask->process_id)
         {
             currentTask->waiting_time = runTime - (currentTask->execution_time - currentTask->left_to_execute);
+            switches += (lastTaskRan != INT_MAX);
         }
 
         currentTask->turnaround_time = runTime;
@@ -56,51 +224,704 @@ void round_robin(struct task_t *task, int quantum, int size)
 
         if(currentTask->left_to_execute != 0)
         {
-            push(&queue, currentTask);
+            minLeft = MIN(minLeft, currentTask->left_to_execute);
+            readyRequeue(&ready);
+        }
+        else
+        {
+            run_metrics_add(&metrics, currentTask->waiting_time, currentTask->turnaround_time);
+            readyPop(&ready);
+        }
+
+        roundRemaining--;
+
+        trace_event(config->trace, currentTask->process_id, currentTask->waiting_time, currentTask->turnaround_time);
+    }
+
+    // The averages come from the running sums, with
+    // no second pass over the tasks
+    trace_finish(config->trace, &metrics);
+
+    if(stats != NULL)
+    {
+        stats->slices = slices + skippedSlices;
+        stats->skipped_slices = skippedSlices;
+        stats->switches = switches;
+        stats->allocations = readyAllocations(&ready) - allocationsAtStart;
+        stats->overhead = overhead;
+    }
+
+    // Cleanup
+    freeReadyQueue(&ready);
+}
+
+
+int round_robin_events(struct task_t *task, int quantum, int size, struct trace_sink_t *trace, struct rr_stats_t *stats)
+{
+    struct event_queue_t events;
+    struct node_t* queue = NULL;
+    struct task_t* running = NULL;
+    struct event_t event;
+    int lastTaskRan = INT_MAX;
+    long long slices = 0;
+    long long switches = 0;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    // NOTE: Zero length slices would be requeued
+    //       forever
+    if(quantum < 1)
+    {
+        fprintf(stderr, "%s() ERROR: Quantum must be at least 1!\n", __func__);
+        return 1;
+    }
+
+    queue = create_empty_queue();
+
+    // Every arrival plus the one slice end pending
+    // at any time
+    if((queue == NULL) || event_queue_init(&events, size + 1))
+    {
+        empty_queue(&queue);
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    // NOTE: Arrivals are pushed first, so one at the
+    //       same time as a slice end is handled first
+    //       and queued ahead of the requeued task
+    for(int i = 0; i < size; i++)
+    {
+        event_push(&events, task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    while(!event_queue_is_empty(&events))
+    {
+        event_pop(&events, &event);
+
+        if(event.kind == EVENT_ARRIVAL)
+        {
+            push(&queue, &(task[event.index]));
+        }
+        else
+        {
+            // Calculate task wait time and turnaround time
+            // as of the end of its slice
+            running->turnaround_time = (int)(event.time - running->arrival_time);
+            running->waiting_time = running->turnaround_time - (running->execution_time - running->left_to_execute);
+
+            trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+
+            if(running->left_to_execute != 0)
+            {
+                push(&queue, running);
+            }
+            else
+            {
+                run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+            }
+
+            running = NULL;
+        }
+
+        // "Execute" the first ready task for a slice once
+        // the CPU is free
+        if((running == NULL) && !is_empty(&queue))
+        {
+            running = peek(&queue);
+            pop(&queue);
+
+            int taskRuntime = MIN(running->left_to_execute, quantum);
+
+            running->left_to_execute -= taskRuntime;
+            slices++;
+
+            if(lastTaskRan != running->process_id)
+            {
+                switches += (lastTaskRan != INT_MAX);
+            }
+
+            lastTaskRan = running->process_id;
+
+            if(event_push(&events, event.time + taskRuntime, EVENT_SLICE_END, (int)(running - task)))
+            {
+                status = 1;
+                break;
+            }
         }
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    if(stats != NULL)
+    {
+        stats->slices = slices;
+        stats->skipped_slices = 0;
+        stats->switches = switches;
+        stats->allocations = get_queue(&queue)->allocations;
+        stats->overhead = 0;
+    }
+
+    // Cleanup
+    empty_queue(&queue);
+    event_queue_free(&events);
+
+    return status;
+}
+
+
+int round_robin_live(struct task_t *task, int quantum, int size, struct intake_queue_t *intake, int drain_limit,
+                     struct trace_sink_t *trace, struct rr_stats_t *stats)
+{
+    struct node_t* queue = NULL;
+    struct task_t* running;
+    long long now = 0;
+    int lastTaskRan = INT_MAX;
+    long long slices = 0;
+    long long switches = 0;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    if((quantum < 1) || (drain_limit < 1))
+    {
+        fprintf(stderr, "%s() ERROR: Quantum and drain limit must be at least 1!\n", __func__);
+        return 1;
+    }
 
+    queue = create_empty_queue();
+
+    if(queue == NULL)
+    {
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; (i < size) && (status == 0); i++)
+    {
+        task[i].arrival_time = 0;
+        status = queueTask(&queue, &(task[i]));
+    }
+
+    if((status == 0) && (drainIntake(intake, &queue, now, drain_limit) < 0))
+    {
+        status = 1;
+    }
+
+    while(status == 0)
+    {
+        if(is_empty(&queue))
+        {
+            // NOTE: Read before draining, so a closed and
+            //       empty intake can't be refilled behind it
+            int closed = intake_is_closed(intake);
+            int moved = drainIntake(intake, &queue, now, drain_limit);
+
+            if(moved < 0)
+            {
+                status = 1;
+            }
+            else if(moved == 0)
+            {
+                if(closed)
+                {
+                    break;
+                }
+
+                sched_yield();
+            }
+
+            continue;
+        }
+
+        // "Execute" the first ready task for a slice
+        running = peek(&queue);
         pop(&queue);
 
-        // Print times to console
-        printf("\nTask[%d] Wait Time: %d\n", currentTask->process_id, currentTask->waiting_time);
-        printf("Task[%d] Turnaround Time: %d\n", currentTask->process_id, currentTask->turnaround_time);
+        int taskRuntime = MIN(running->left_to_execute, quantum);
+
+        running->left_to_execute -= taskRuntime;
+        now += taskRuntime;
+        slices++;
+
+        if(lastTaskRan != running->process_id)
+        {
+            switches += (lastTaskRan != INT_MAX);
+        }
+
+        lastTaskRan = running->process_id;
+
+        // Calculate task wait time and turnaround time
+        // as of the end of its slice
+        running->turnaround_time = (int)(now - running->arrival_time);
+        running->waiting_time = running->turnaround_time - (running->execution_time - running->left_to_execute);
+
+        trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+
+        // Tasks handed in during the slice are queued
+        // ahead of the requeued task
+        if(drainIntake(intake, &queue, now, drain_limit) < 0)
+        {
+            status = 1;
+        }
+        else if(running->left_to_execute != 0)
+        {
+            status = queueTask(&queue, running);
+        }
+        else
+        {
+            run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+        }
     }
 
-    // Calculate average times
-    float avgWaitTime = calculate_average_wait_time(task, size);
-    float avgTurnaroundTime = calculate_average_turn_around_time(task, size);
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
 
-    // Print average times
-    printf("Average Wait Time: %f\n", avgWaitTime);
-    printf("Average Turnaround Time: %f\n", avgTurnaroundTime);
+    if(stats != NULL)
+    {
+        stats->slices = slices;
+        stats->skipped_slices = 0;
+        stats->switches = switches;
+        stats->allocations = get_queue(&queue)->allocations;
+        stats->overhead = 0;
+    }
 
     // Cleanup
-    free(queue->next);
-    free(queue);
+    empty_queue(&queue);
+
+    return status;
 }
 
 
 float calculate_average_wait_time(struct task_t *task, int size)
 {
-    float totalTime = 0;
+    // NOTE: A float sum stops counting single time
+    //       units past 2^24
+    long long totalTime = 0;
 
     for(int i = 0; i < size; i++)
     {
         totalTime += task[i].waiting_time;
     }
     
-    return totalTime / size;
+    return (float)((double)totalTime / size);
 }
 
 
 float calculate_average_turn_around_time(struct task_t *task, int size)
 {
-    float totalTime = 0;
+    // NOTE: A float sum stops counting single time
+    //       units past 2^24
+    long long totalTime = 0;
 
     for(int i = 0; i < size; i++)
     {
         totalTime += task[i].turnaround_time;
     }
     
-    return totalTime / size;
-}
\ No newline at end of file
+    return (float)((double)totalTime / size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Build the ready queue from the task
+///         array using the configured backend
+///
+/// @param[in] ready The ready queue, with its
+///                  backend already selected
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+///
+/// @return 1: Couldn't create the queue; 0: Success
+///-------------------------------------------------
+static int createReadyQueue(struct ready_queue_t* ready, struct task_t* task, int size)
+{
+    ready->list = NULL;
+
+    if((ready->backend == RR_READY_RING) && (ready->arena != NULL))
+    {
+        if(ring_refill(ready->arena, task, size))
+        {
+            return 1;
+        }
+
+        ready->ring = *(ready->arena);
+
+        return 0;
+    }
+
+    if(ready->backend == RR_READY_RING)
+    {
+        return ring_create(&(ready->ring), task, size);
+    }
+
+    ready->list = create_queue(task, size);
+
+    return (ready->list == NULL);
+}
+
+
+///-------------------------------------------------
+/// @brief  Check if the ready queue is empty
+///
+/// @param[in] ready The ready queue
+///
+/// @return True/False
+///-------------------------------------------------
+static int readyIsEmpty(struct ready_queue_t* ready)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        return ring_is_empty(&(ready->ring));
+    }
+
+    return is_empty(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the number of tasks in the ready
+///         queue
+///
+/// @param[in] ready The ready queue
+///
+/// @return The number of tasks
+///-------------------------------------------------
+static int readyCount(struct ready_queue_t* ready)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        return (int)ready->ring.count;
+    }
+
+    return queue_size(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Start a walk over the ready queue
+///
+/// @param[in] ready The ready queue
+/// @param[out] cursor Position of the walk
+///
+/// @return The top-most task, NULL if empty
+///-------------------------------------------------
+static struct task_t* readyFirst(struct ready_queue_t* ready, struct ready_cursor_t* cursor)
+{
+    cursor->node = ready->list;
+    cursor->offset = 0;
+
+    return readyNext(ready, cursor);
+}
+
+
+///-------------------------------------------------
+/// @brief  Step a walk over the ready queue
+///
+/// @param[in] ready The ready queue
+/// @param[in] cursor Position of the walk
+///
+/// @return The next task, NULL past the end
+///-------------------------------------------------
+static struct task_t* readyNext(struct ready_queue_t* ready, struct ready_cursor_t* cursor)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        if(cursor->offset == ready->ring.count)
+        {
+            return NULL;
+        }
+
+        cursor->offset++;
+
+        return ready->ring.buffer[(ready->ring.head + cursor->offset - 1) & ready->ring.mask];
+    }
+
+    // NOTE: The last task node links back to the
+    //       sentinel; an empty queue's links to NULL
+    cursor->node = cursor->node->next;
+
+    if((cursor->node == NULL) || (cursor->node == ready->list))
+    {
+        return NULL;
+    }
+
+    return cursor->node->task;
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the task at the top of the ready
+///         queue
+///
+/// @param[in] ready The ready queue
+///
+/// @return The top-most task
+///-------------------------------------------------
+static struct task_t* readyPeek(struct ready_queue_t* ready)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        return ring_peek(&(ready->ring));
+    }
+
+    return peek(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Move the task at the top of the ready
+///         queue to the end of it
+///
+/// @param[in] ready The ready queue
+///-------------------------------------------------
+static void readyRequeue(struct ready_queue_t* ready)
+{
+    struct task_t* task = readyPeek(ready);
+
+    if(ready->backend == RR_READY_RING)
+    {
+        // NOTE: Popping first frees a slot, so the
+        //       push never has to grow the ring
+        ring_pop(&(ready->ring));
+        ring_push(&(ready->ring), task);
+        return;
+    }
+
+    if(ready->rotate)
+    {
+        rotate(&(ready->list));
+        return;
+    }
+
+    push(&(ready->list), task);
+    pop(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Remove the task at the top of the ready
+///         queue
+///
+/// @param[in] ready The ready queue
+///-------------------------------------------------
+static void readyPop(struct ready_queue_t* ready)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        ring_pop(&(ready->ring));
+        return;
+    }
+
+    if(ready->rotate)
+    {
+        retire(&(ready->list));
+        return;
+    }
+
+    pop(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the number of allocations and frees
+///         the ready queue has made so far
+///
+/// @param[in] ready The ready queue
+///
+/// @return The allocation count
+///-------------------------------------------------
+static long long readyAllocations(struct ready_queue_t* ready)
+{
+    if(ready->backend == RR_READY_RING)
+    {
+        return ready->ring.allocations;
+    }
+
+    return get_queue(&(ready->list))->allocations;
+}
+
+
+///-------------------------------------------------
+/// @brief  Release the memory held by the ready
+///         queue
+///
+/// @param[in] ready The ready queue
+///-------------------------------------------------
+static void freeReadyQueue(struct ready_queue_t* ready)
+{
+    if((ready->backend == RR_READY_RING) && (ready->arena != NULL))
+    {
+        // Hand the buffer, which may have grown, back
+        // to the caller
+        *(ready->arena) = ready->ring;
+        return;
+    }
+
+    if(ready->backend == RR_READY_RING)
+    {
+        ring_free(&(ready->ring));
+        return;
+    }
+
+    empty_queue(&(ready->list));
+}
+
+
+///-------------------------------------------------
+/// @brief  Run whole rounds of the ready queue in
+///         one step
+///
+/// @param[in] ready The ready queue, at the start
+///                  of a round
+/// @param[in] rounds Number of rounds to run; no
+///                   task may finish during them
+/// @param[in] quantum Length of a time slice
+/// @param[in] switchCost Time lost to each switch
+/// @param[in,out] runTime Current time
+/// @param[in,out] overhead Time lost to switches
+/// @param[in] trace Sink for every skipped slice
+///
+/// @return Number of slices the rounds contained
+///-------------------------------------------------
+static long long skipRounds(struct ready_queue_t* ready, int rounds, int quantum, int switchCost, int* runTime,
+                            long long* overhead, struct trace_sink_t* trace)
+{
+    struct ready_cursor_t cursor;
+    struct task_t* currentTask;
+    int count = readyCount(ready);
+
+    // NOTE: With more than one task every slice of a
+    //       round follows a slice of another task
+    int slice = quantum + ((count > 1) ? switchCost : 0);
+
+    *overhead += (long long)rounds * count * (slice - quantum);
+
+    if(trace_enabled(trace))
+    {
+        // Replay the slices one at a time so that each
+        // of them can be emitted, in queue order
+        for(int round = 0; round < rounds; round++)
+        {
+            for(currentTask = readyFirst(ready, &cursor); currentTask != NULL; currentTask = readyNext(ready, &cursor))
+            {
+                *runTime += slice;
+                currentTask->left_to_execute -= quantum;
+                currentTask->waiting_time = *runTime - (currentTask->execution_time - currentTask->left_to_execute);
+                currentTask->turnaround_time = *runTime;
+
+                trace_event(trace, currentTask->process_id, currentTask->waiting_time, currentTask->turnaround_time);
+            }
+        }
+
+        return (long long)rounds * count;
+    }
+
+    int position = 0;
+    int roundLength = slice * count;
+
+    // Each task ends the skipped rounds at the time of
+    // its slice in the last of them
+    for(currentTask = readyFirst(ready, &cursor); currentTask != NULL; currentTask = readyNext(ready, &cursor))
+    {
+        position++;
+
+        currentTask->left_to_execute -= rounds * quantum;
+        currentTask->turnaround_time = *runTime + ((rounds - 1) * roundLength) + (position * slice);
+        currentTask->waiting_time = currentTask->turnaround_time - (currentTask->execution_time - currentTask->left_to_execute);
+    }
+
+    *runTime += rounds * roundLength;
+
+    return (long long)rounds * count;
+}
+
+
+///-------------------------------------------------
+/// @brief  Time lost switching to a task: the
+///         fixed switch cost plus a cache refill
+///         which grows with the time it was away
+///
+/// @param[in] config Costs of a switch
+/// @param[in] task The task being switched in
+/// @param[in] runTime Time of the switch
+///
+/// @return The overhead
+///-------------------------------------------------
+static int switchOverhead(const struct rr_config_t* config, struct task_t* task, int runTime)
+{
+    int cost = config->switch_cost;
+
+    if((config->refill_cost <= 0) || (config->refill_window <= 0))
+    {
+        return cost;
+    }
+
+    // NOTE: A task which hasn't run yet has nothing in
+    //       the cache; otherwise its turnaround time is
+    //       the end of its last slice
+    long long away = (task->left_to_execute == task->execution_time) ? config->refill_window
+                                                                       : (long long)runTime + cost - task->turnaround_time;
+
+    away = MIN(away, config->refill_window);
+
+    return cost + (int)((config->refill_cost * away) / config->refill_window);
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task, checking that its node
+///         could be allocated
+///
+/// @param[in] queue The ready queue
+/// @param[in] task The task
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int queueTask(struct node_t** queue, struct task_t* task)
+{
+    int size = queue_size(queue);
+
+    push(queue, task);
+
+    return queue_size(queue) == size;
+}
+
+
+///-------------------------------------------------
+/// @brief  Move tasks from the intake to the tail
+///         of the ready queue, arriving now
+///
+/// @param[in] intake The intake queue
+/// @param[in] queue The ready queue
+/// @param[in] now Current time
+/// @param[in] limit Most tasks to move
+///
+/// @return The number of tasks moved; -1: A task
+///         was taken but couldn't be queued
+///-------------------------------------------------
+static int drainIntake(struct intake_queue_t* intake, struct node_t** queue, long long now, int limit)
+{
+    struct task_t* task;
+    int moved = 0;
+
+    while((moved < limit) && ((task = intake_pop(intake)) != NULL))
+    {
+        task->arrival_time = (int)now;
+
+        if(queueTask(queue, task))
+        {
+            return -1;
+        }
+
+        moved++;
+    }
+
+    return moved;
+}
@@ -2,6 +2,11 @@
 #ifndef __ROUND_ROBIN__
 #define __ROUND_ROBIN__
 
+#include "trace.h"
+
+struct ring_t;
+struct intake_queue_t;
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Structure which holds the Task information
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -21,6 +26,96 @@ struct task_t {
 
 	// Amount of time left for the task until it is finished
     int left_to_execute;
+
+    // Time at which the task arrives; only the event-driven schedulers (round_robin_events(),
+    // shortest_remaining_time_first(), priority_round_robin() and the periodic schedulers) honour
+    // it, and round_robin_live() sets it; everything else treats every task as arriving at 0
+    int arrival_time;
+
+    // Fixed priority of the task, 0 being the highest; only priority_round_robin(),
+    // fixed_priority_periodic() and the response time analysis honour it
+    int priority;
+
+    // Time between the releases of two jobs of a periodic task (the least time for a sporadic one),
+    // 0 for a task released once; only the periodic schedulers (see edf.h) and the response time
+    // analysis (see rta.h) honour it, and treat execution_time as the worst case execution time of
+    // each job and arrival_time as the first release
+    int period;
+
+    // Time from the release of a job to its deadline, 0 for the period
+    int deadline;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Backends which can hold the round robin ready queue
+//----------------------------------------------------------------------------------------------------------------------------------
+enum rr_ready_queue_t {
+    // Linked list of node_t (see queue.h)
+    RR_READY_LINKED,
+
+    // Contiguous power-of-two ring buffer of task pointers (see ring.h)
+    RR_READY_RING
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which selects how the round robin scheduler runs
+//----------------------------------------------------------------------------------------------------------------------------------
+struct rr_config_t {
+
+    // Backend holding the ready queue
+    enum rr_ready_queue_t ready_queue;
+
+    // Requeue a task by relinking its node instead of pushing a new node and popping the old one,
+    // and retire finished nodes instead of freeing them, so the linked backend does no allocation
+    // or free once the queue is built
+    int rotate_requeue;
+
+    // When every ready task has more than k quanta left at the start of a round, run the next k
+    // rounds in one step instead of one slice at a time
+    int skip_rounds;
+
+    // Sink which receives the wait and turn around time of the running task after every slice,
+    // NULL to emit nothing
+    struct trace_sink_t* trace;
+
+    // Initialized ring which the RR_READY_RING ready queue is built in and left in after the run,
+    // so repeated runs reuse its buffer instead of allocating their own; NULL to allocate per run
+    struct ring_t* arena;
+
+    // Time lost to every switch from one task to another, during which no task executes
+    int switch_cost;
+
+    // Extra time a task loses refilling its cache when it is switched in after being away for
+    // refill_window or longer, or for the first time; 0 for none
+    int refill_cost;
+
+    // Time away after which a task's cache is cold; the refill cost grows linearly up to it, so a
+    // task which was away for half of it loses half of refill_cost. Round skipping is turned off
+    // while both refill fields are set, since the cost then differs from slice to slice
+    int refill_window;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds counters collected during a round robin run
+//----------------------------------------------------------------------------------------------------------------------------------
+struct rr_stats_t {
+
+    // Number of quantum slices executed
+    long long slices;
+
+    // Number of those slices which were accounted for in bulk by skipped rounds
+    long long skipped_slices;
+
+    // Number of slices which ran a different task than the slice before them
+    long long switches;
+
+    // Number of nodes the ready queue took from or gave back to its node pool after it was built
+    // (number of buffer reallocations for RR_READY_RING)
+    long long allocations;
+
+    // Time spent on switches and cache refills rather than on executing tasks (see rr_config_t),
+    // already included in the wait and turn around times
+    long long overhead;
 };
 
 //----------------------------------------------------------------------------------------------------------------------------------
@@ -43,9 +138,84 @@ void init(struct task_t *task, int *execution, int size);
 //----------------------------------------------------------------------------------------------------------------------------------
 void round_robin(struct task_t *task, int quantum, int size);
 
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Returns the default configuration
+///
+/// @note round_robin() uses this with a TRACE_TEXT sink on stdout
+///
+/// @return The default configuration
+//----------------------------------------------------------------------------------------------------------------------------------
+struct rr_config_t rr_default_config(void);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm with the given configuration and
+/// calculate the wait and turn around time for each task
+///
+/// @note A quantum below 1 is rejected with a message and leaves the tasks untouched
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+/// @param[in] config How to run the scheduler, NULL for rr_default_config()
+/// @param[out] stats Counters collected during the run, may be NULL
+//----------------------------------------------------------------------------------------------------------------------------------
+void round_robin_with_config(struct task_t *task, int quantum, int size, const struct rr_config_t *config,
+                             struct rr_stats_t *stats);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm as a discrete-event simulation in which every task arrives
+/// at its arrival time, and calculate the wait and turn around time for each task
+///
+/// @note Arrivals and slice ends are kept in a min-heap (see events.h) and the clock jumps from one
+///       event to the next, so idle gaps cost nothing and the tasks needn't be sorted by arrival
+///       time. A task arriving as a slice ends is queued ahead of the task being requeued, and
+///       tasks arriving together are queued in array order. Wait and turn around times are
+///       measured from the arrival time. With every task arriving at 0 the times, slices and
+///       switches are the same as round_robin_with_config().
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+/// @param[in] trace Sink which receives the times of the running task after every slice, may be NULL
+/// @param[out] stats Counters collected during the run, may be NULL
+///
+/// @return 0 on success, 1 if the quantum is below 1 or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_events(struct task_t *task, int quantum, int size, struct trace_sink_t *trace, struct rr_stats_t *stats);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm on a set of tasks which keeps growing while it runs, and
+/// calculate the wait and turn around time for each task
+///
+/// @note Other threads hand in tasks through the intake queue (see intake.h). After every slice at
+///       most drain_limit of them are moved to the ready queue, ahead of the task being requeued,
+///       so a burst of pushes can't stall the slices. A task arrives at the time it is moved to the
+///       ready queue, and its arrival_time is set to it; the tasks of the buffer arrive at 0. When
+///       no task is ready the scheduler keeps taking from the intake, yielding the CPU in between,
+///       and it returns once the intake is closed and empty and every task has finished.
+///
+/// @param[in] task The buffer containing the tasks known before the run, may be NULL if size is 0
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+/// @param[in] intake The queue the other tasks come through
+/// @param[in] drain_limit The most tasks taken from the intake after a slice, at least 1
+/// @param[in] trace Sink which receives the times of the running task after every slice, may be NULL
+/// @param[out] stats Counters collected during the run, may be NULL
+///
+/// @return 0 on success, 1 if the quantum or drain_limit is below 1 or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_live(struct task_t *task, int quantum, int size, struct intake_queue_t *intake, int drain_limit,
+                     struct trace_sink_t *trace, struct rr_stats_t *stats);
+
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Calculates the average wait time.
 ///
+/// @note This takes another pass over the tasks; the schedulers keep the same average, and more, in
+///       the metrics of their trace sink as they run (see metrics.h)
+///
 /// @param[in] task The buffer containing task data
 /// @param[in] size The size of the buffer
 ///
@@ -56,6 +226,9 @@ float calculate_average_wait_time(struct task_t *task, int size);
 //----------------------------------------------------------------------------------------------------------------------------------
 /// @brief Calculates the average turn around time.
 ///
+/// @note This takes another pass over the tasks; the schedulers keep the same average, and more, in
+///       the metrics of their trace sink as they run (see metrics.h)
+///
 /// @param[in] task The buffer containing task data
 /// @param[in] size The size of the buffer
 ///
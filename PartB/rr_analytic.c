@@ -0,0 +1,182 @@
+#include "rr_analytic.h"
+
+
+///-------------------------------------------------
+/// @brief  Sort key of a task: the round it
+///         finishes in, then its queue position
+///-------------------------------------------------
+struct round_key_t {
+    // Round (1-based) in which the task finishes
+    long long round;
+
+    // Index of the task in the task array
+    int index;
+};
+
+
+static int compareRoundKeys(const void* lhs, const void* rhs);
+static void fenwickAdd(int* tree, int size, int index, int delta);
+static int fenwickPrefix(int* tree, int index);
+
+
+///-------------------------------------------------
+/// @brief  Round Robin scheduler computed a whole
+///         round at a time
+///
+/// @param[in] task The task queue array
+/// @param[in] quantum Length of a time slice
+/// @param[in] size Size of the task queue array
+///
+/// @return 1: Invalid quantum or malloc failed;
+///         0: Success
+///-------------------------------------------------
+int round_robin_analytic(struct task_t *task, int quantum, int size)
+{
+    if((task == NULL) || (quantum < 1))
+    {
+        return 1;
+    }
+
+    if(size < 1)
+    {
+        return 0;
+    }
+
+    struct round_key_t* keys = (struct round_key_t*)malloc(size * sizeof(struct round_key_t));
+    int* longer = (int*)calloc(size + 1, sizeof(int));
+
+    if((keys == NULL) || (longer == NULL))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't allocate the round keys!\n", __func__);
+        free(keys);
+        free(longer);
+        return 1;
+    }
+
+    // A task needing r quanta finishes in round r
+    // NOTE: A task with nothing to execute still
+    //       takes its (empty) turn in round 1
+    for(int i = 0; i < size; i++)
+    {
+        long long rounds = ((long long)task[i].execution_time + quantum - 1) / quantum;
+
+        keys[i].round = (rounds < 1) ? 1 : rounds;
+        keys[i].index = i;
+
+        // Every task is still running in round 1
+        fenwickAdd(longer, size, i, 1);
+    }
+
+    qsort(keys, size, sizeof(struct round_key_t), compareRoundKeys);
+
+    // Work done by the tasks that have finished
+    long long finishedWork = 0;
+    int remaining = size;
+
+    for(int start = 0; start < size;)
+    {
+        long long round = keys[start].round;
+        int end = start;
+
+        // Tasks which finish in this round, already in
+        // queue order
+        while((end < size) && (keys[end].round == round))
+        {
+            fenwickAdd(longer, size, keys[end].index, -1);
+            end++;
+        }
+
+        // Time at which this round starts
+        long long roundStart = finishedWork + ((round - 1) * quantum * remaining);
+        long long finishingAhead = 0;
+
+        for(int k = start; k < end; k++)
+        {
+            struct task_t* currentTask = &(task[keys[k].index]);
+            long long lastSlice = currentTask->execution_time - ((round - 1) * quantum);
+
+            // Tasks ahead of this one that keep running
+            // past this round use a full quantum
+            long long longerAhead = fenwickPrefix(longer, keys[k].index);
+            long long completion = roundStart + (longerAhead * quantum) + finishingAhead + lastSlice;
+
+            currentTask->turnaround_time = (int)completion;
+            currentTask->waiting_time = (int)(completion - currentTask->execution_time);
+            currentTask->left_to_execute = 0;
+
+            finishingAhead += lastSlice;
+            finishedWork += currentTask->execution_time;
+        }
+
+        remaining -= (end - start);
+        start = end;
+    }
+
+    free(keys);
+    free(longer);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  qsort() comparator ordering round keys
+///         by round, then by task index
+///
+/// @param[in] lhs Left hand round key
+/// @param[in] rhs Right hand round key
+///
+/// @return <0, 0, >0 as lhs sorts before, with or
+///         after rhs
+///-------------------------------------------------
+static int compareRoundKeys(const void* lhs, const void* rhs)
+{
+    const struct round_key_t* left = (const struct round_key_t*)lhs;
+    const struct round_key_t* right = (const struct round_key_t*)rhs;
+
+    if(left->round != right->round)
+    {
+        return (left->round < right->round) ? -1 : 1;
+    }
+
+    return left->index - right->index;
+}
+
+
+///-------------------------------------------------
+/// @brief  Add to one entry of a Fenwick tree
+///
+/// @param[in] tree The tree, of size + 1 entries
+/// @param[in] size The number of entries
+/// @param[in] index 0-based entry to update
+/// @param[in] delta Amount to add
+///-------------------------------------------------
+static void fenwickAdd(int* tree, int size, int index, int delta)
+{
+    for(int i = index + 1; i <= size; i += (i & -i))
+    {
+        tree[i] += delta;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Sum the entries of a Fenwick tree before
+///         an index
+///
+/// @param[in] tree The tree
+/// @param[in] index 0-based entry to stop before
+///
+/// @return The sum of entries [0, index)
+///-------------------------------------------------
+static int fenwickPrefix(int* tree, int index)
+{
+    int sum = 0;
+
+    for(int i = index; i > 0; i -= (i & -i))
+    {
+        sum += tree[i];
+    }
+
+    return sum;
+}
@@ -0,0 +1,27 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __RR_ANALYTIC__
+#define __RR_ANALYTIC__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Calculate the round robin wait and turn around time for each task without simulating
+/// the individual quantum slices
+///
+/// @note Every task arrives at time 0 and the ready queue starts in task array order, exactly as
+///       in round_robin(). A task needing r quanta finishes during round r, so its completion time
+///       is the work done by everyone in the first r - 1 rounds plus the slices run ahead of it in
+///       round r. Sorting by round and counting the longer tasks ahead with a Fenwick tree gives
+///       every completion time in O(n log n), independent of the total execution time.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+///
+/// @return 0 on success, 1 if the quantum is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_analytic(struct task_t *task, int quantum, int size);
+
+#endif // __RR_ANALYTIC__
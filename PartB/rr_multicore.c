@@ -0,0 +1,269 @@
+#include "rr_multicore.h"
+#include "ring.h"
+#include <limits.h>
+
+
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+
+static long long runGlobal(struct task_t* task, int quantum, int size, int cores, struct core_stats_t* stats);
+static long long runPartitioned(struct task_t* task, int quantum, int size, const struct multicore_config_t* config, struct core_stats_t* stats);
+static long long runSlice(struct task_t* currentTask, int quantum, long long start, struct core_stats_t* stats);
+
+
+///-------------------------------------------------
+/// @brief  Round Robin scheduler over several
+///         cores
+///
+/// @param[in] task The task queue array
+/// @param[in] quantum Length of a time slice
+/// @param[in] size Size of the task queue array
+/// @param[in] config The processors
+/// @param[out] stats Statistics of each core, or
+///                   NULL
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int round_robin_multicore(struct task_t* task, int quantum, int size, const struct multicore_config_t* config,
+                          struct core_stats_t* stats)
+{
+    if((config == NULL) || (config->cores < 1) || (quantum < 1))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid quantum or core count!\n", __func__);
+        return 1;
+    }
+
+    struct core_stats_t* core = (stats != NULL) ? stats : (struct core_stats_t*)malloc((size_t)config->cores * sizeof(struct core_stats_t));
+
+    if(core == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create core statistics!\n", __func__);
+        return 1;
+    }
+
+    long long makespan = (config->mode == MULTICORE_PARTITIONED) ? runPartitioned(task, quantum, size, config, core)
+                                                                 : runGlobal(task, quantum, size, config->cores, core);
+
+    if(makespan >= 0)
+    {
+        cores_utilization(core, config->cores, makespan);
+    }
+
+    if(stats == NULL)
+    {
+        free(core);
+    }
+
+    return (makespan < 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Run slices from one shared ready queue
+///         on whichever core frees up first
+///
+/// @param[in] task The task queue array
+/// @param[in] quantum Length of a time slice
+/// @param[in] size Size of the task queue array
+/// @param[in] cores Number of cores
+/// @param[out] stats Statistics of each core
+///
+/// @return Makespan; -1: Allocation failed
+///-------------------------------------------------
+static long long runGlobal(struct task_t* task, int quantum, int size, int cores, struct core_stats_t* stats)
+{
+    struct core_tree_t freeAt;
+    struct ring_t ready;
+    struct task_t** running = (struct task_t**)calloc((size_t)cores, sizeof(struct task_t*));
+    long long makespan = 0;
+
+    if(running == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create cores!\n", __func__);
+        return -1;
+    }
+
+    if(core_tree_init(&freeAt, cores))
+    {
+        free(running);
+        return -1;
+    }
+
+    if(ring_create(&ready, task, size))
+    {
+        core_tree_free(&freeAt);
+        free(running);
+        return -1;
+    }
+
+    for(int i = 0; i < cores; i++)
+    {
+        stats[i].busy_time = 0;
+        stats[i].tasks = 0;
+    }
+
+    // Each step ends the slice of the core which
+    // frees up first and starts its next one
+    for(int core = core_tree_min(&freeAt); core_tree_key(&freeAt, core) != LLONG_MAX; core = core_tree_min(&freeAt))
+    {
+        long long now = core_tree_key(&freeAt, core);
+
+        // NOTE: The ready queue never holds more tasks
+        //       than it started with, so this never grows
+        if((running[core] != NULL) && (running[core]->left_to_execute != 0))
+        {
+            ring_push(&ready, running[core]);
+        }
+
+        running[core] = NULL;
+
+        // A core which finds the queue empty is done:
+        // the queue only shrinks from here, and any task
+        // still running is requeued by its own core
+        if(ring_is_empty(&ready))
+        {
+            core_tree_set(&freeAt, core, LLONG_MAX);
+            continue;
+        }
+
+        running[core] = ring_peek(&ready);
+        ring_pop(&ready);
+
+        long long end = runSlice(running[core], quantum, now, &(stats[core]));
+
+        makespan = (end > makespan) ? end : makespan;
+        core_tree_set(&freeAt, core, end);
+    }
+
+    ring_free(&ready);
+    core_tree_free(&freeAt);
+    free(running);
+
+    return makespan;
+}
+
+
+///-------------------------------------------------
+/// @brief  Assign the tasks to cores, then run
+///         round robin on each core by itself
+///
+/// @param[in] task The task queue array
+/// @param[in] quantum Length of a time slice
+/// @param[in] size Size of the task queue array
+/// @param[in] config The processors
+/// @param[out] stats Statistics of each core
+///
+/// @return Makespan; -1: Allocation failed
+///-------------------------------------------------
+static long long runPartitioned(struct task_t* task, int quantum, int size, const struct multicore_config_t* config, struct core_stats_t* stats)
+{
+    int cores = config->cores;
+    int largest = 0;
+    long long makespan = 0;
+    struct ring_t ready;
+
+    // NOTE: One spare entry keeps an empty task
+    //       array from asking malloc for 0 bytes
+    int* core = (int*)malloc(((size_t)size + 1) * sizeof(int));
+    int* first = (int*)calloc((size_t)cores + 1, sizeof(int));
+    struct task_t** byCore = (struct task_t**)malloc(((size_t)size + 1) * sizeof(struct task_t*));
+
+    if((core == NULL) || (first == NULL) || (byCore == NULL) || cores_partition(task, size, config, core, stats))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't partition the tasks!\n", __func__);
+        free(core);
+        free(first);
+        free(byCore);
+        return -1;
+    }
+
+    // Group the tasks by core, keeping array order
+    // within each core
+    for(int i = 0; i < cores; i++)
+    {
+        first[i + 1] = first[i] + stats[i].tasks;
+        largest = (stats[i].tasks > largest) ? stats[i].tasks : largest;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        byCore[first[core[i]]++] = &(task[i]);
+    }
+
+    if(ring_init(&ready, largest))
+    {
+        free(core);
+        free(first);
+        free(byCore);
+        return -1;
+    }
+
+    for(int i = 0, start = 0; i < cores; i++)
+    {
+        long long now = 0;
+
+        // NOTE: Grouping advanced first[i] to the end
+        //       of core i's tasks
+        for(; start < first[i]; start++)
+        {
+            ring_push(&ready, byCore[start]);
+        }
+
+        stats[i].busy_time = 0;
+        stats[i].tasks = 0;
+
+        while(!ring_is_empty(&ready))
+        {
+            struct task_t* currentTask = ring_peek(&ready);
+
+            ring_pop(&ready);
+            now = runSlice(currentTask, quantum, now, &(stats[i]));
+
+            if(currentTask->left_to_execute != 0)
+            {
+                ring_push(&ready, currentTask);
+            }
+        }
+
+        makespan = (now > makespan) ? now : makespan;
+    }
+
+    ring_free(&ready);
+    free(core);
+    free(first);
+    free(byCore);
+
+    return makespan;
+}
+
+
+///-------------------------------------------------
+/// @brief  Run one slice of a task on a core
+///
+/// @param[in] currentTask The task
+/// @param[in] quantum Length of a time slice
+/// @param[in] start Time the slice starts
+/// @param[in] stats Statistics of the core
+///
+/// @return Time the slice ends
+///-------------------------------------------------
+static long long runSlice(struct task_t* currentTask, int quantum, long long start, struct core_stats_t* stats)
+{
+    int taskRuntime = MIN(currentTask->left_to_execute, quantum);
+    long long end = start + taskRuntime;
+
+    currentTask->left_to_execute -= taskRuntime;
+    stats->busy_time += taskRuntime;
+
+    // NOTE: A task only waits while it isn't running,
+    //       so its wait is what it didn't spend
+    //       executing
+    if(currentTask->left_to_execute == 0)
+    {
+        currentTask->turnaround_time = (int)end;
+        currentTask->waiting_time = (int)(end - currentTask->execution_time);
+        stats->tasks++;
+    }
+
+    return end;
+}
@@ -0,0 +1,31 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+#include "cores.h"
+
+#ifndef __RR_MULTICORE__
+#define __RR_MULTICORE__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm on several cores and calculate the wait and turn around
+/// time for each task
+///
+/// @note With MULTICORE_GLOBAL every core takes its next slice from one shared ready queue, and a
+///       core whose slice ends requeues its task before taking the next one; cores which free up
+///       at the same time do so in core order. With MULTICORE_PARTITIONED each core runs round
+///       robin over the tasks assigned to it. Either way each slice costs O(log cores).
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+/// @param[in] size The size of the buffer
+/// @param[in] config The processors
+/// @param[out] stats The buffer receiving the statistics of each core, one entry per core; may be
+///                   NULL
+///
+/// @return 0 on success, 1 if the quantum or configuration is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_multicore(struct task_t *task, int quantum, int size, const struct multicore_config_t *config,
+                          struct core_stats_t *stats);
+
+#endif // __RR_MULTICORE__
@@ -1,6 +1,21 @@
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
 #include "ctest.h"
 #include "rr.h"
+#include "queue.h"
+#include "ring.h"
+#include "rr_analytic.h"
+#include "sweep.h"
+#include "tuner.h"
+#include "rr_multicore.h"
+#include "srtf.h"
+#include "priority.h"
+#include "edf.h"
+#include "rta.h"
+#include "mlfq.h"
+#include "intake.h"
+#include "taskset.h"
 
 
 ///-------------------------------------------------
@@ -223,4 +238,1232 @@ CTEST2(customRR2, differentExeTimes_process)
         ASSERT_EQUAL(wait[i], data->task[i].waiting_time);
         ASSERT_EQUAL(turnaround[i], data->task[i].turnaround_time);
     }
-}
\ No newline at end of file
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the ring buffer ready
+///         queue produces the same times as the
+///         linked ready queue
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(ringRR, ringReadyQueue_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    int turnaround[] = {3, 5 ,26, 28, 35, 16, 17, 20, 22, 34};
+    int wait[] = {0, 3, 22, 23, 28, 14, 16, 17, 20, 28};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[10];
+
+    struct rr_config_t config = rr_default_config();
+    config.ready_queue = RR_READY_RING;
+
+    init(task, execution, size);
+    round_robin_with_config(task, 3, size, &config, NULL);
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(wait[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaround[i], task[i].turnaround_time);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that switch and cache refill
+///         costs are charged to the clock, with and
+///         without skipped rounds
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(switchCostRR, overhead_process)
+{
+    int execution[] = {3, 3};
+    int longer[] = {10, 12, 11};
+    struct task_t task[3];
+    struct task_t skipped[3];
+    struct rr_config_t config = rr_default_config();
+    struct rr_stats_t stats;
+
+    // A runs 0-2, B 3-5, A 6-7 and B 8-9, each after a
+    // switch of 1
+    config.switch_cost = 1;
+    init(task, execution, 2);
+    round_robin_with_config(task, 2, 2, &config, &stats);
+
+    ASSERT_EQUAL(7, task[0].turnaround_time);
+    ASSERT_EQUAL(4, task[0].waiting_time);
+    ASSERT_EQUAL(9, task[1].turnaround_time);
+    ASSERT_EQUAL(6, task[1].waiting_time);
+    ASSERT_EQUAL(3, stats.switches);
+    ASSERT_EQUAL(3, stats.overhead);
+
+    // B starts cold (4), then A is away 6 of a window
+    // of 8 (3) and B is away 4 (2)
+    config.switch_cost = 0;
+    config.refill_cost = 4;
+    config.refill_window = 8;
+    init(task, execution, 2);
+    round_robin_with_config(task, 2, 2, &config, &stats);
+
+    ASSERT_EQUAL(12, task[0].turnaround_time);
+    ASSERT_EQUAL(15, task[1].turnaround_time);
+    ASSERT_EQUAL(12, task[1].waiting_time);
+    ASSERT_EQUAL(9, stats.overhead);
+
+    // Skipped rounds charge the same switches
+    config = rr_default_config();
+    config.switch_cost = 2;
+    init(task, longer, 3);
+    round_robin_with_config(task, 3, 3, &config, &stats);
+
+    config.skip_rounds = 1;
+    init(skipped, longer, 3);
+    round_robin_with_config(skipped, 3, 3, &config, &stats);
+
+    ASSERT_TRUE(stats.skipped_slices > 0);
+    ASSERT_EQUAL(2 * stats.switches, stats.overhead);
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(task[i].turnaround_time, skipped[i].turnaround_time);
+        ASSERT_EQUAL(task[i].waiting_time, skipped[i].waiting_time);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the schedulers summarize
+///         the final times of the tasks they finish
+///         into the metrics of their sink
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(metricsRR, onlineSummary_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[10];
+    struct trace_sink_t trace;
+    struct rr_config_t config = rr_default_config();
+    long long waitSum = 0;
+    int waitMax = 0;
+
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+    config.trace = &trace;
+    config.skip_rounds = 1;
+
+    init(task, execution, size);
+    round_robin_with_config(task, 3, size, &config, NULL);
+
+    for(int i = 0; i < size; i++)
+    {
+        waitSum += task[i].waiting_time;
+        waitMax = (task[i].waiting_time > waitMax) ? task[i].waiting_time : waitMax;
+    }
+
+    ASSERT_EQUAL(size, trace.metrics.wait.count);
+    ASSERT_EQUAL(waitSum, trace.metrics.wait.sum);
+    ASSERT_EQUAL(waitMax, trace.metrics.wait.max);
+    ASSERT_EQUAL(35, trace.metrics.turnaround.max);
+    ASSERT_DBL_NEAR(calculate_average_turn_around_time(task, size), metric_mean(&(trace.metrics.turnaround)));
+
+    // A second run adds to the same summaries
+    init(task, execution, size);
+    ASSERT_EQUAL(0, round_robin_events(task, 3, size, &trace, NULL));
+    ASSERT_EQUAL(2 * size, trace.metrics.wait.count);
+    ASSERT_EQUAL(2 * waitSum, trace.metrics.wait.sum);
+    ASSERT_EQUAL(3, trace.metrics.turnaround.min);
+    trace_close(&trace);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the round robin scheduler
+///         records the final times of every task in
+///         the histograms of its sink
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(histogramRR, tailPercentiles_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[10];
+    struct trace_sink_t trace;
+    struct rr_config_t config = rr_default_config();
+    struct latency_percentiles_t turnaround;
+
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+    ASSERT_EQUAL(0, trace_keep_histograms(&trace));
+    config.trace = &trace;
+
+    // Turnarounds 3 5 16 17 20 22 26 28 34 35, each
+    // below 256 so in a bucket of its own
+    init(task, execution, size);
+    round_robin_with_config(task, 3, size, &config, NULL);
+    histogram_percentiles(&(trace.turnaround_histogram), &turnaround);
+
+    ASSERT_EQUAL(size, trace.wait_histogram.count);
+    ASSERT_EQUAL(20, turnaround.p50);
+    ASSERT_EQUAL(34, turnaround.p90);
+    ASSERT_EQUAL(35, turnaround.p99);
+    ASSERT_EQUAL(35, turnaround.p999);
+    ASSERT_EQUAL(35, turnaround.max);
+    ASSERT_EQUAL(28, trace.wait_histogram.max);
+
+    trace_close(&trace);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the round robin scheduler on
+///         a structure-of-arrays task set
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST2(customRR2, taskSet_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_set_t set;
+    struct task_t task[10];
+
+    ASSERT_EQUAL(0, task_set_create(&set, data->size));
+
+    task_set_init(&set, execution);
+    ASSERT_EQUAL(0, task_set_round_robin(&set, 3));
+
+    ASSERT_DBL_NEAR(calculate_average_wait_time(data->task, data->size), task_set_average_wait_time(&set));
+    ASSERT_DBL_NEAR(calculate_average_turn_around_time(data->task, data->size), task_set_average_turn_around_time(&set));
+
+    task_set_to_tasks(&set, task);
+    task_set_free(&set);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        ASSERT_EQUAL(data->task[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(data->task[i].turnaround_time, task[i].turnaround_time);
+        ASSERT_EQUAL(0, task[i].left_to_execute);
+    }
+}
+
+///-------------------------------------------------
+/// @brief  Validate that a task set mapped onto
+///         column files schedules in place and
+///         the results can be mapped back
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST2(customRR2, mappedColumns_process)
+{
+    char workloadPath[] = "/tmp/rrworkloadXXXXXX";
+    char resultsPath[] = "/tmp/rrresultsXXXXXX";
+    struct column_desc_t workloadColumns[] = {{COLUMN_EXECUTION_TIME, 4, 0}, {COLUMN_ARRIVAL_TIME, 8, 0}};
+    struct column_desc_t resultColumns[] = {{COLUMN_WAITING_TIME, 4, 0}, {COLUMN_TURNAROUND_TIME, 4, 0}};
+    struct column_file_t workload;
+    struct column_file_t results;
+    struct task_set_t set;
+    int width = 0;
+
+    close(mkstemp(workloadPath));
+    close(mkstemp(resultsPath));
+
+    ASSERT_EQUAL(0, column_file_create(&workload, workloadPath, data->size, workloadColumns, 2));
+
+    int* execution = (int*)column_file_column(&workload, COLUMN_EXECUTION_TIME, NULL);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        execution[i] = data->task[i].execution_time;
+    }
+
+    column_file_close(&workload);
+
+    // Map the workload back read-only
+    ASSERT_EQUAL(0, column_file_open(&workload, workloadPath));
+    ASSERT_NOT_NULL(column_file_column(&workload, COLUMN_ARRIVAL_TIME, &width));
+    ASSERT_EQUAL(8, width);
+    ASSERT_NULL(column_file_column(&workload, COLUMN_PRIORITY, NULL));
+
+    ASSERT_EQUAL(0, column_file_create(&results, resultsPath, data->size, resultColumns, 2));
+    ASSERT_EQUAL(0, task_set_map(&set, &workload, &results));
+
+    // The engine works on the mappings themselves
+    ASSERT_TRUE(set.execution_time == column_file_column(&workload, COLUMN_EXECUTION_TIME, NULL));
+    ASSERT_TRUE(set.waiting_time == column_file_column(&results, COLUMN_WAITING_TIME, NULL));
+
+    ASSERT_EQUAL(0, task_set_round_robin(&set, 3));
+    task_set_free(&set);
+
+    ASSERT_EQUAL(0, column_file_sync(&results));
+    column_file_close(&results);
+    column_file_close(&workload);
+
+    ASSERT_EQUAL(0, column_file_open(&results, resultsPath));
+    ASSERT_EQUAL(data->size, results.rows);
+
+    int* waiting = (int*)column_file_column(&results, COLUMN_WAITING_TIME, NULL);
+    int* turnaround = (int*)column_file_column(&results, COLUMN_TURNAROUND_TIME, NULL);
+
+    for(int i = 0; i < data->size; i++)
+    {
+        ASSERT_EQUAL(data->task[i].waiting_time, waiting[i]);
+        ASSERT_EQUAL(data->task[i].turnaround_time, turnaround[i]);
+    }
+
+    // Results hold no execution times and are
+    // mapped read-only
+    ASSERT_EQUAL(1, task_set_map(&set, &results, &results));
+
+    column_file_close(&results);
+    unlink(workloadPath);
+    unlink(resultsPath);
+}
+
+
+
+///-------------------------------------------------
+/// @brief  Validate that the analytic solver
+///         matches the simulator across several
+///         quanta, including tasks with nothing to
+///         execute
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(analyticRR, matchesSimulator_process)
+{
+    struct task_t simulated[40];
+    struct task_t analytic[40];
+    int execution[40];
+    int size = sizeof(execution) / sizeof(execution[0]);
+    unsigned int seed = 12345;
+
+    // Fixed pseudo-random bursts between 0 and 20
+    for(int i = 0; i < size; i++)
+    {
+        seed = (seed * 1103515245u) + 12345u;
+        execution[i] = (int)((seed >> 16) % 21);
+    }
+
+    for(int quantum = 1; quantum <= 7; quantum += 3)
+    {
+        init(simulated, execution, size);
+        round_robin(simulated, quantum, size);
+
+        init(analytic, execution, size);
+        ASSERT_EQUAL(0, round_robin_analytic(analytic, quantum, size));
+
+        for(int i = 0; i < size; i++)
+        {
+            ASSERT_EQUAL(simulated[i].waiting_time, analytic[i].waiting_time);
+            ASSERT_EQUAL(simulated[i].turnaround_time, analytic[i].turnaround_time);
+            ASSERT_EQUAL(0, analytic[i].left_to_execute);
+        }
+    }
+
+    ASSERT_EQUAL(1, round_robin_analytic(analytic, 0, size));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that a threaded quantum sweep
+///         gives the same table as running each
+///         quantum in turn
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(sweepRR, matchesSerial_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6, 0, 9};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    int quanta[] = {4, 1, 2, 9, 3};
+    int count = sizeof(quanta) / sizeof(quanta[0]);
+    struct sweep_result_t result[5];
+    struct task_t task[12];
+
+    ASSERT_EQUAL(0, round_robin_sweep(execution, size, quanta, count, 3, result));
+
+    for(int i = 0; i < count; i++)
+    {
+        init(task, execution, size);
+        round_robin_with_config(task, quanta[i], size, NULL, NULL);
+
+        ASSERT_EQUAL(quanta[i], result[i].quantum);
+        ASSERT_DBL_NEAR(calculate_average_wait_time(task, size), result[i].average_wait_time);
+        ASSERT_DBL_NEAR(calculate_average_turn_around_time(task, size), result[i].average_turn_around_time);
+    }
+
+    // 1, 5 and 9; the last row matches the list
+    ASSERT_EQUAL(0, round_robin_sweep_range(execution, size, 1, 10, 4, 0, result));
+    ASSERT_EQUAL(9, result[2].quantum);
+    ASSERT_DBL_NEAR(result[3].average_wait_time, result[2].average_wait_time);
+
+    ASSERT_EQUAL(1, round_robin_sweep(execution, size, (int[]){2, 0}, 2, 2, result));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the tuner finds the same
+///         best cost as trying every quantum, while
+///         scheduling far fewer of them
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(tuneRR, matchesLinearScan_process)
+{
+    int execution[] = {400, 900, 250, 900, 3};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[5];
+    struct rr_stats_t stats;
+    struct tune_result_t wait;
+    struct tune_result_t switching;
+    double bestWait = 0;
+    double bestSwitching = 0;
+
+    ASSERT_EQUAL(0, round_robin_tune(execution, size, 1, 0, TUNE_AVERAGE_WAIT, 0, &wait));
+    ASSERT_EQUAL(0, round_robin_tune(execution, size, 1, 0, TUNE_TURNAROUND_WITH_SWITCHES, 2.5, &switching));
+
+    for(int quantum = 1; quantum <= 900; quantum++)
+    {
+        init(task, execution, size);
+        round_robin_with_config(task, quantum, size, NULL, &stats);
+
+        double averageWait = calculate_average_wait_time(task, size);
+        double cost = calculate_average_turn_around_time(task, size) + (2.5 * stats.switches);
+
+        bestWait = ((quantum == 1) || (averageWait < bestWait)) ? averageWait : bestWait;
+        bestSwitching = ((quantum == 1) || (cost < bestSwitching)) ? cost : bestSwitching;
+    }
+
+    ASSERT_DBL_NEAR(bestWait, wait.cost);
+    ASSERT_DBL_NEAR(bestSwitching, switching.cost);
+    ASSERT_TRUE(wait.evaluations < 200);
+
+    // Long enough quanta run the tasks in order, and
+    // only the ends of the range are left
+    ASSERT_EQUAL(0, round_robin_tune(execution, size, 900, 2000, TUNE_P99_WAIT, 0, &wait));
+    ASSERT_EQUAL(900, wait.quantum);
+    ASSERT_EQUAL(1, wait.evaluations);
+    ASSERT_DBL_NEAR(2450, wait.cost);
+
+    ASSERT_EQUAL(1, round_robin_tune(execution, size, 0, 10, TUNE_AVERAGE_WAIT, 0, &wait));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate round robin on two cores
+///         sharing one queue and on partitioned
+///         cores, which on one core is plain round
+///         robin
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(multicoreRR, globalAndPartitioned_process)
+{
+    int execution[] = {3, 5, 2};
+    int longer[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_t task[10];
+    struct task_t single[10];
+    struct core_stats_t stats[2];
+    struct multicore_config_t config = multicore_default_config(2);
+
+    // Hand-calculated times for two cores and a
+    // quantum of 2
+    int waitTime[] = {0, 1, 2};
+    int turnaroundTime[] = {3, 6, 4};
+
+    init(task, execution, 3);
+    ASSERT_EQUAL(0, round_robin_multicore(task, 2, 3, &config, stats));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(4, stats[0].busy_time);
+    ASSERT_EQUAL(1, stats[0].tasks);
+    ASSERT_EQUAL(2, stats[1].tasks);
+    ASSERT_DBL_NEAR(1.0, stats[1].utilization);
+
+    // Worst fit puts the first two tasks on their
+    // own core and the last one with the shorter
+    config.mode = MULTICORE_PARTITIONED;
+    config.fit = FIT_WORST;
+    init(task, execution, 3);
+    ASSERT_EQUAL(0, round_robin_multicore(task, 2, 3, &config, stats));
+
+    ASSERT_EQUAL(5, task[0].turnaround_time);
+    ASSERT_EQUAL(5, task[1].turnaround_time);
+    ASSERT_EQUAL(4, task[2].turnaround_time);
+    ASSERT_EQUAL(2, stats[0].tasks);
+
+    // One core is plain round robin, either way
+    for(int mode = MULTICORE_GLOBAL; mode <= MULTICORE_PARTITIONED; mode++)
+    {
+        config = multicore_default_config(1);
+        config.mode = (enum multicore_mode_t)mode;
+
+        init(task, longer, 10);
+        init(single, longer, 10);
+        ASSERT_EQUAL(0, round_robin_multicore(task, 3, 10, &config, NULL));
+        round_robin_with_config(single, 3, 10, NULL, NULL);
+
+        for(int i = 0; i < 10; i++)
+        {
+            ASSERT_EQUAL(single[i].waiting_time, task[i].waiting_time);
+            ASSERT_EQUAL(single[i].turnaround_time, task[i].turnaround_time);
+        }
+    }
+
+    ASSERT_EQUAL(1, round_robin_multicore(task, 0, 10, &config, NULL));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the event-driven scheduler on
+///         staggered arrivals with an idle gap, and
+///         against the simulator when every task
+///         arrives at 0
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(eventsRR, arrivals_process)
+{
+    int execution[] = {5, 3, 1};
+    int arrival[] = {0, 2, 20};
+    int longer[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_t task[10];
+    struct task_t single[10];
+    struct rr_stats_t stats;
+    struct rr_stats_t singleStats;
+
+    // Hand-calculated times for a quantum of 2; task 1
+    // arrives as task 0's first slice ends and runs
+    // before it, and the CPU idles from 8 to 20
+    int waitTime[] = {3, 2, 0};
+    int turnaroundTime[] = {8, 5, 1};
+
+    init(task, execution, 3);
+
+    for(int i = 0; i < 3; i++)
+    {
+        task[i].arrival_time = arrival[i];
+    }
+
+    ASSERT_EQUAL(0, round_robin_events(task, 2, 3, NULL, &stats));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+        ASSERT_EQUAL(0, task[i].left_to_execute);
+    }
+
+    ASSERT_EQUAL(6, stats.slices);
+    ASSERT_EQUAL(5, stats.switches);
+
+    init(task, longer, 10);
+    init(single, longer, 10);
+    ASSERT_EQUAL(0, round_robin_events(task, 2, 10, NULL, &stats));
+    round_robin_with_config(single, 2, 10, NULL, &singleStats);
+
+    for(int i = 0; i < 10; i++)
+    {
+        ASSERT_EQUAL(single[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(single[i].turnaround_time, task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(singleStats.slices, stats.slices);
+    ASSERT_EQUAL(singleStats.switches, stats.switches);
+
+    // Zero length slices would never end the run
+    ASSERT_EQUAL(1, round_robin_events(task, 0, 10, NULL, NULL));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate shortest remaining time first
+///         on staggered arrivals, and its average
+///         wait against round robin when every task
+///         arrives at 0
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(srtf, shortestRemainingTimeFirst_process)
+{
+    int execution[] = {8, 4, 9, 5};
+    int arrival[] = {0, 1, 2, 3};
+    int longer[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_t task[10];
+    struct task_t rr[10];
+    struct rr_stats_t stats;
+
+    // Hand-calculated times; task 1 preempts task 0,
+    // and task 3 only runs once task 1 is done
+    int waitTime[] = {9, 0, 15, 2};
+    int turnaroundTime[] = {17, 4, 24, 7};
+
+    init(task, execution, 4);
+
+    for(int i = 0; i < 4; i++)
+    {
+        task[i].arrival_time = arrival[i];
+    }
+
+    ASSERT_EQUAL(0, shortest_remaining_time_first(task, 4, NULL, &stats));
+
+    for(int i = 0; i < 4; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+        ASSERT_EQUAL(0, task[i].left_to_execute);
+    }
+
+    ASSERT_EQUAL(5, stats.slices);
+    ASSERT_EQUAL(4, stats.switches);
+
+    // Arriving together, the tasks run shortest first
+    init(task, longer, 10);
+    init(rr, longer, 10);
+    ASSERT_EQUAL(0, shortest_remaining_time_first(task, 10, NULL, NULL));
+    round_robin_with_config(rr, 2, 10, NULL, NULL);
+
+    ASSERT_DBL_NEAR(10.6, calculate_average_wait_time(task, 10));
+    ASSERT_TRUE(calculate_average_wait_time(task, 10) < calculate_average_wait_time(rr, 10));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the bitmap lookup of the ready
+///         list, a preemption by a higher priority
+///         arrival, and round robin within a level
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(priorityRR, bitmapPreemptive_process)
+{
+    int execution[] = {4, 3, 2};
+    int priority[] = {2, 0, 2};
+    int arrival[] = {0, 1, 0};
+    int longer[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    struct task_t task[10];
+    struct task_t rr[10];
+    struct priority_ready_t ready;
+    struct rr_stats_t stats;
+    struct rr_stats_t rrStats;
+
+    // Levels come out highest first across bitmap
+    // words, and FIFO within a level
+    init(task, execution, 3);
+    task[0].priority = 255;
+    task[1].priority = 40;
+    task[2].priority = 40;
+    priority_ready_init(&ready);
+
+    ASSERT_EQUAL(-1, priority_ready_highest(&ready));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(0, priority_ready_push(&ready, &(task[i])));
+    }
+
+    ASSERT_EQUAL(40, priority_ready_highest(&ready));
+    ASSERT_TRUE(priority_ready_pop(&ready) == &(task[1]));
+    ASSERT_TRUE(priority_ready_pop(&ready) == &(task[2]));
+    ASSERT_EQUAL(255, priority_ready_highest(&ready));
+    ASSERT_TRUE(priority_ready_pop(&ready) == &(task[0]));
+    ASSERT_NULL(priority_ready_pop(&ready));
+
+    task[0].priority = PRIORITY_LEVELS;
+    ASSERT_EQUAL(1, priority_ready_push(&ready, &(task[0])));
+    priority_ready_free(&ready);
+
+    // Hand-calculated times for a quantum of 2; task 1
+    // preempts task 0 at 1, and tasks 2 and 0 then
+    // share their level
+    int waitTime[] = {5, 0, 4};
+    int turnaroundTime[] = {9, 3, 6};
+
+    init(task, execution, 3);
+
+    for(int i = 0; i < 3; i++)
+    {
+        task[i].priority = priority[i];
+        task[i].arrival_time = arrival[i];
+    }
+
+    ASSERT_EQUAL(0, priority_round_robin(task, 2, 3, NULL, &stats));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(waitTime[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaroundTime[i], task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(6, stats.slices);
+    ASSERT_EQUAL(3, stats.switches);
+
+    // A single level is plain round robin
+    init(task, longer, 10);
+    init(rr, longer, 10);
+
+    for(int i = 0; i < 10; i++)
+    {
+        task[i].priority = 7;
+    }
+
+    ASSERT_EQUAL(0, priority_round_robin(task, 3, 10, NULL, &stats));
+    round_robin_with_config(rr, 3, 10, NULL, &rrStats);
+
+    for(int i = 0; i < 10; i++)
+    {
+        ASSERT_EQUAL(rr[i].waiting_time, task[i].waiting_time);
+        ASSERT_EQUAL(rr[i].turnaround_time, task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(rrStats.slices, stats.slices);
+    ASSERT_EQUAL(rrStats.switches, stats.switches);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate earliest deadline first on a
+///         feasible and an overloaded periodic task
+///         set over their hyperperiods
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(edf, periodicHyperperiod_process)
+{
+    int execution[] = {1, 2, 3};
+    int period[] = {4, 6, 8};
+    struct task_t task[3];
+    struct edf_stats_t stats;
+    struct edf_task_stats_t perTask[3];
+
+    // Utilization 23/24 fits, so no job is late
+    init(task, execution, 3);
+
+    for(int i = 0; i < 3; i++)
+    {
+        task[i].period = period[i];
+    }
+
+    ASSERT_EQUAL(0, earliest_deadline_first(task, 3, 0, &stats, perTask));
+    ASSERT_EQUAL(24, stats.hyperperiod);
+    ASSERT_EQUAL(13, stats.jobs);
+    ASSERT_EQUAL(0, stats.misses);
+    ASSERT_EQUAL(23, stats.busy_time);
+    ASSERT_TRUE(stats.max_lateness <= 0);
+    ASSERT_EQUAL(6, perTask[0].jobs);
+    ASSERT_EQUAL(3, perTask[2].jobs);
+
+    // Hand-calculated run of C = 2 every 3 and C = 2
+    // every 4: the third and fourth jobs of task 0 are
+    // late by 1 and 2
+    init(task, execution, 2);
+    task[0].execution_time = 2;
+    task[0].period = 3;
+    task[1].execution_time = 2;
+    task[1].period = 4;
+
+    ASSERT_EQUAL(0, earliest_deadline_first(task, 2, 0, &stats, perTask));
+    ASSERT_EQUAL(12, stats.hyperperiod);
+    ASSERT_EQUAL(7, stats.jobs);
+    ASSERT_EQUAL(2, stats.misses);
+    ASSERT_EQUAL(2, stats.max_lateness);
+    ASSERT_EQUAL(5, stats.max_response);
+    ASSERT_EQUAL(14, stats.makespan);
+    ASSERT_EQUAL(0, stats.preemptions);
+    ASSERT_EQUAL(2, perTask[0].misses);
+    ASSERT_EQUAL(0, perTask[1].misses);
+    ASSERT_EQUAL(4, perTask[1].max_response);
+    ASSERT_EQUAL(5, task[0].turnaround_time);
+    ASSERT_EQUAL(3, task[0].waiting_time);
+
+    // A one-shot task needs a deadline
+    task[0].period = 0;
+    ASSERT_EQUAL(1, earliest_deadline_first(task, 2, 0, &stats, NULL));
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate the rate monotonic response
+///         times of a textbook task set against a
+///         fixed priority run over its hyperperiod
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(rta, rateMonotonic_process)
+{
+    int execution[] = {3, 3, 5};
+    int period[] = {7, 12, 20};
+    long long response[3];
+    struct task_t task[3];
+    struct rta_result_t result;
+    struct edf_stats_t stats;
+    struct edf_task_stats_t perTask[3];
+
+    init(task, execution, 3);
+
+    for(int i = 0; i < 3; i++)
+    {
+        task[i].period = period[i];
+    }
+
+    ASSERT_EQUAL(0, response_time_analysis(task, 3, RTA_RATE_MONOTONIC, response, &result));
+    ASSERT_TRUE(result.schedulable);
+    ASSERT_EQUAL(-1, result.first_miss);
+    ASSERT_EQUAL(3, response[0]);
+    ASSERT_EQUAL(6, response[1]);
+    ASSERT_EQUAL(20, response[2]);
+
+    // The worst job of each task, released together
+    // at time 0, takes exactly its response time
+    ASSERT_EQUAL(0, rta_assign_priorities(task, 3, RTA_RATE_MONOTONIC));
+    ASSERT_EQUAL(0, fixed_priority_periodic(task, 3, 0, &stats, perTask));
+    ASSERT_EQUAL(0, stats.misses);
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_EQUAL(response[i], perTask[i].max_response);
+    }
+
+    ASSERT_EQUAL(0, response_time_analysis(task, 3, RTA_TASK_PRIORITY, NULL, &result));
+    ASSERT_TRUE(result.schedulable);
+
+    // One more unit of work pushes the lowest priority
+    // task past its period
+    task[0].execution_time = 4;
+    ASSERT_EQUAL(0, response_time_analysis(task, 3, RTA_RATE_MONOTONIC, response, &result));
+    ASSERT_FALSE(result.schedulable);
+    ASSERT_EQUAL(2, result.first_miss);
+    ASSERT_EQUAL(-1, response[2]);
+    ASSERT_EQUAL(0, fixed_priority_periodic(task, 3, 0, &stats, perTask));
+    ASSERT_TRUE(perTask[2].misses > 0);
+
+    // Deadline monotonic puts a tight deadline first,
+    // which then delays task 0 past its period
+    task[0].execution_time = 3;
+    task[2].deadline = 5;
+    ASSERT_EQUAL(0, response_time_analysis(task, 3, RTA_DEADLINE_MONOTONIC, response, &result));
+    ASSERT_EQUAL(5, response[2]);
+    ASSERT_EQUAL(-1, response[0]);
+    ASSERT_EQUAL(0, result.first_miss);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate demotion, preemption by a new
+///         arrival and periodic boosts of the
+///         multilevel feedback queue
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(mlfq, demoteAndBoost_process)
+{
+    int execution[] = {5, 2};
+    struct task_t task[2];
+    struct mlfq_config_t config = mlfq_default_config(2, 2);
+    struct mlfq_stats_t stats;
+
+    // Task 0 uses up level 0 by time 2, and task 1
+    // preempts it at level 1 when it arrives at 3
+    init(task, execution, 2);
+    task[1].arrival_time = 3;
+
+    ASSERT_EQUAL(4, config.quantum[1]);
+    ASSERT_EQUAL(0, multilevel_feedback_queue(task, 2, &config, NULL, &stats));
+    ASSERT_EQUAL(7, task[0].turnaround_time);
+    ASSERT_EQUAL(2, task[0].waiting_time);
+    ASSERT_EQUAL(2, task[1].turnaround_time);
+    ASSERT_EQUAL(0, task[1].waiting_time);
+    ASSERT_EQUAL(4, stats.slices);
+    ASSERT_EQUAL(2, stats.switches);
+    ASSERT_EQUAL(1, stats.demotions);
+    ASSERT_EQUAL(1, stats.preemptions);
+    ASSERT_EQUAL(0, stats.boosts);
+
+    // A lone task sinks to level 2 and is lifted back
+    // to level 0 at times 4 and 8
+    config = mlfq_default_config(3, 1);
+    config.boost_interval = 4;
+    execution[0] = 10;
+    init(task, execution, 1);
+
+    ASSERT_EQUAL(0, multilevel_feedback_queue(task, 1, &config, NULL, &stats));
+    ASSERT_EQUAL(10, task[0].turnaround_time);
+    ASSERT_EQUAL(6, stats.slices);
+    ASSERT_EQUAL(5, stats.demotions);
+    ASSERT_EQUAL(2, stats.boosts);
+    ASSERT_EQUAL(0, stats.preemptions);
+
+    config.quantum[1] = 0;
+    ASSERT_EQUAL(1, multilevel_feedback_queue(task, 1, &config, NULL, &stats));
+}
+
+
+///-------------------------------------------------
+/// @brief  Tasks one producer thread hands to the
+///         live scheduler
+///-------------------------------------------------
+struct intake_producer_t {
+    // Queue the tasks are pushed to
+    struct intake_queue_t* intake;
+
+    // Tasks to push, in order
+    struct task_t* task;
+
+    // Links of the tasks
+    struct intake_node_t* node;
+
+    // Number of tasks
+    int size;
+
+    // Producers still pushing, shared by all of them
+    int* running;
+};
+
+
+///-------------------------------------------------
+/// @brief  Push every task of a producer, yielding
+///         now and then so the scheduler runs in
+///         between; the last producer to finish
+///         closes the intake
+///
+/// @param[in] arg The producer
+///
+/// @return NULL
+///-------------------------------------------------
+static void* produceTasks(void* arg)
+{
+    struct intake_producer_t* producer = (struct intake_producer_t*)arg;
+
+    for(int i = 0; i < producer->size; i++)
+    {
+        intake_push(producer->intake, &(producer->node[i]), &(producer->task[i]));
+
+        if((i % 64) == 0)
+        {
+            sched_yield();
+        }
+    }
+
+    if(__atomic_sub_fetch(producer->running, 1, __ATOMIC_ACQ_REL) == 0)
+    {
+        intake_close(producer->intake);
+    }
+
+    return NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the live round robin
+///         scheduler takes a bounded number of
+///         tasks from its intake after each slice,
+///         and runs every task several producer
+///         threads hand in while it runs
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(liveRR, intakeProducers_process)
+{
+    int execution[] = {4, 1};
+    int handedIn[] = {3, 2};
+    struct task_t task[2];
+    struct task_t late[2];
+    struct intake_node_t lateNode[2];
+    struct intake_queue_t intake;
+    struct rr_stats_t stats;
+
+    init(task, execution, 2);
+    init(late, handedIn, 2);
+    late[0].process_id = 10;
+    late[1].process_id = 11;
+
+    // One task taken per slice: 10 arrives at 0 and
+    // 11 after the first slice, ahead of task 0
+    intake_init(&intake);
+    intake_push(&intake, &(lateNode[0]), &(late[0]));
+    intake_push(&intake, &(lateNode[1]), &(late[1]));
+    intake_close(&intake);
+
+    ASSERT_EQUAL(0, round_robin_live(task, 2, 2, &intake, 1, NULL, &stats));
+    ASSERT_EQUAL(9, task[0].turnaround_time);
+    ASSERT_EQUAL(5, task[0].waiting_time);
+    ASSERT_EQUAL(3, task[1].turnaround_time);
+    ASSERT_EQUAL(2, task[1].waiting_time);
+    ASSERT_EQUAL(0, late[0].arrival_time);
+    ASSERT_EQUAL(10, late[0].turnaround_time);
+    ASSERT_EQUAL(7, late[0].waiting_time);
+    ASSERT_EQUAL(2, late[1].arrival_time);
+    ASSERT_EQUAL(5, late[1].turnaround_time);
+    ASSERT_EQUAL(3, late[1].waiting_time);
+    ASSERT_EQUAL(6, stats.slices);
+    ASSERT_EQUAL(5, stats.switches);
+    ASSERT_NULL(intake_pop(&intake));
+
+    // Producers race the scheduler, which returns
+    // only once the intake is closed and empty
+    enum { PRODUCERS = 4, PER_PRODUCER = 2000 };
+    struct task_t* produced = (struct task_t*)malloc(PRODUCERS * PER_PRODUCER * sizeof(struct task_t));
+    struct intake_node_t* node = (struct intake_node_t*)malloc(PRODUCERS * PER_PRODUCER * sizeof(struct intake_node_t));
+    struct intake_producer_t producer[PRODUCERS];
+    pthread_t thread[PRODUCERS];
+    struct trace_sink_t trace;
+    long long executed = 5;
+    long long end = 0;
+    int running = PRODUCERS;
+
+    ASSERT_TRUE((produced != NULL) && (node != NULL));
+    ASSERT_EQUAL(0, trace_open(&trace, TRACE_NONE, NULL));
+
+    for(int i = 0; i < PRODUCERS * PER_PRODUCER; i++)
+    {
+        produced[i].process_id = 100 + i;
+        produced[i].execution_time = 1 + (i % 7);
+        produced[i].left_to_execute = produced[i].execution_time;
+        executed += produced[i].execution_time;
+    }
+
+    init(task, execution, 2);
+    intake_init(&intake);
+
+    for(int i = 0; i < PRODUCERS; i++)
+    {
+        producer[i].intake = &intake;
+        producer[i].task = produced + (i * PER_PRODUCER);
+        producer[i].node = node + (i * PER_PRODUCER);
+        producer[i].size = PER_PRODUCER;
+        producer[i].running = &running;
+        ASSERT_EQUAL(0, pthread_create(&(thread[i]), NULL, produceTasks, &(producer[i])));
+    }
+
+    ASSERT_EQUAL(0, round_robin_live(task, 3, 2, &intake, 8, &trace, &stats));
+
+    for(int i = 0; i < PRODUCERS; i++)
+    {
+        ASSERT_EQUAL(0, pthread_join(thread[i], NULL));
+    }
+
+    ASSERT_EQUAL(2 + (PRODUCERS * PER_PRODUCER), trace.metrics.turnaround.count);
+
+    end = (task[0].turnaround_time > task[1].turnaround_time) ? task[0].turnaround_time : task[1].turnaround_time;
+
+    for(int i = 0; i < PRODUCERS * PER_PRODUCER; i++)
+    {
+        ASSERT_EQUAL(0, produced[i].left_to_execute);
+        ASSERT_EQUAL(produced[i].execution_time, produced[i].turnaround_time - produced[i].waiting_time);
+
+        long long finish = (long long)produced[i].arrival_time + produced[i].turnaround_time;
+
+        end = (finish > end) ? finish : end;
+    }
+
+    // Time stands still while waiting on the
+    // producers, so the last task ends once every
+    // unit of work is done
+    ASSERT_EQUAL(executed, end);
+
+    ASSERT_EQUAL(1, round_robin_live(task, 3, 2, &intake, 0, NULL, NULL));
+    ASSERT_EQUAL(1, round_robin_live(task, 0, 2, &intake, 1, NULL, NULL));
+
+    trace_close(&trace);
+    free(produced);
+    free(node);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that skipping rounds gives the
+///         same times as running every slice, on
+///         both ready queue backends and with the
+///         slice trace on and off
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(skipRR, matchesSimulator_process)
+{
+    int execution[] = {30, 21, 40, 35, 27, 29, 31, 33};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t simulated[8];
+    struct task_t skipped[8];
+    struct rr_stats_t stats;
+
+    init(simulated, execution, size);
+    round_robin(simulated, 4, size);
+
+    for(int variant = 0; variant < 4; variant++)
+    {
+        struct trace_sink_t trace;
+        struct rr_config_t config = rr_default_config();
+        FILE* stream = tmpfile();
+
+        config.skip_rounds = 1;
+        config.ready_queue = (variant & 1) ? RR_READY_RING : RR_READY_LINKED;
+
+        ASSERT_NOT_NULL(stream);
+        trace_open(&trace, (variant & 2) ? TRACE_BINARY : TRACE_NONE, stream);
+        config.trace = &trace;
+
+        init(skipped, execution, size);
+        round_robin_with_config(skipped, 4, size, &config, &stats);
+        trace_close(&trace);
+
+        // NOTE: Skipped slices are still traced one by one
+        //       when the trace is on
+        long long expected = (variant & 2) ? stats.slices : 0;
+
+        ASSERT_EQUAL(expected, trace.events);
+        ASSERT_EQUAL(expected * (long long)sizeof(struct trace_event_t), ftell(stream));
+        fclose(stream);
+
+        for(int i = 0; i < size; i++)
+        {
+            ASSERT_EQUAL(simulated[i].waiting_time, skipped[i].waiting_time);
+            ASSERT_EQUAL(simulated[i].turnaround_time, skipped[i].turnaround_time);
+            ASSERT_EQUAL(0, skipped[i].left_to_execute);
+        }
+
+        // The shortest task has 21 left after the first
+        // round, so the next 4 rounds of 8 slices each
+        // are skipped in one step
+        ASSERT_EQUAL(32, stats.skipped_slices);
+    }
+
+    // A quantum of 0 is turned down before any round
+    // could be skipped
+    init(skipped, execution, size);
+    round_robin_with_config(skipped, 0, size, NULL, NULL);
+    ASSERT_EQUAL(execution[0], skipped[0].left_to_execute);
+    ASSERT_EQUAL(0, skipped[0].turnaround_time);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that rotating requeued nodes
+///         gives the same times as push()/pop()
+///         without a single allocation or free
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(rotateRR, allocationFree_process)
+{
+    int execution[] = {3, 2, 4, 5, 7, 2, 1, 3, 2, 6};
+    int turnaround[] = {3, 5 ,26, 28, 35, 16, 17, 20, 22, 34};
+    int wait[] = {0, 3, 22, 23, 28, 14, 16, 17, 20, 28};
+    int size = sizeof(execution) / sizeof(execution[0]);
+    struct task_t task[10];
+    struct rr_stats_t stats;
+
+    struct rr_config_t config = rr_default_config();
+    config.rotate_requeue = 1;
+
+    init(task, execution, size);
+    round_robin_with_config(task, 3, size, &config, &stats);
+
+    for(int i = 0; i < size; i++)
+    {
+        ASSERT_EQUAL(wait[i], task[i].waiting_time);
+        ASSERT_EQUAL(turnaround[i], task[i].turnaround_time);
+    }
+
+    ASSERT_EQUAL(15, stats.slices);
+    ASSERT_EQUAL(0, stats.allocations);
+
+    // The default push()/pop() requeue allocates a node and frees
+    // another on each of the 5 requeues, and frees each of the 10
+    // finished nodes
+    init(task, execution, size);
+    round_robin_with_config(task, 3, size, NULL, &stats);
+
+    ASSERT_EQUAL(20, stats.allocations);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the ring keeps FIFO order
+///         while wrapping around and growing, and
+///         after it was freed
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(ring, growth_process)
+{
+    struct task_t task[40];
+    struct ring_t ring;
+
+    ASSERT_EQUAL(0, ring_init(&ring, 1));
+
+    // Wrap the head part way around the buffer
+    for(int i = 0; i < 10; i++)
+    {
+        ring_push(&ring, &task[0]);
+        ring_pop(&ring);
+    }
+
+    // Push enough tasks to force the ring to grow twice
+    for(int i = 0; i < 40; i++)
+    {
+        ASSERT_EQUAL(0, ring_push(&ring, &task[i]));
+    }
+
+    for(int i = 0; i < 40; i++)
+    {
+        ASSERT_TRUE(ring_peek(&ring) == &task[i]);
+        ring_pop(&ring);
+    }
+
+    ASSERT_TRUE(ring_is_empty(&ring));
+    ring_free(&ring);
+
+    // A freed ring gets a new buffer on the next push
+    ASSERT_EQUAL(0, ring_push(&ring, &task[1]));
+    ASSERT_TRUE(ring_peek(&ring) == &task[1]);
+    ring_free(&ring);
+}
+
+
+///-------------------------------------------------
+/// @brief  Validate that the tail-tracked queue
+///         keeps FIFO order and its size when
+///         pushing onto an empty queue
+///
+/// @retval  None
+///-------------------------------------------------
+CTEST(queue, tailTracking_process)
+{
+    struct task_t task[3];
+    struct node_t* queue = create_empty_queue();
+
+    ASSERT_NOT_NULL(queue);
+    ASSERT_TRUE(is_empty(&queue));
+
+    // Drain the queue once in between to make sure
+    // the tail falls back to the sentinel
+    push(&queue, &task[0]);
+    pop(&queue);
+    ASSERT_TRUE(is_empty(&queue));
+
+    for(int i = 0; i < 3; i++)
+    {
+        push(&queue, &task[i]);
+    }
+
+    ASSERT_EQUAL(3, queue_size(&queue));
+
+    for(int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(peek(&queue) == &task[i]);
+        pop(&queue);
+    }
+
+    ASSERT_EQUAL(0, queue_size(&queue));
+    ASSERT_NULL(peek(&queue));
+
+    empty_queue(&queue);
+    ASSERT_NULL(queue);
+}
@@ -0,0 +1,281 @@
+#include "rta.h"
+
+
+///-------------------------------------------------
+/// @brief  Task and the key it is ranked by
+///-------------------------------------------------
+struct rta_rank_t {
+    long long key;
+    int index;
+};
+
+
+static struct rta_rank_t* rankTasks(struct task_t* task, int size, enum rta_order_t order);
+static long long limitOf(struct task_t* task);
+static int compareRank(const void* left, const void* right);
+
+
+///-------------------------------------------------
+/// @brief  Write the rank of each task into its
+///         priority
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] order Order to rank the tasks in
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int rta_assign_priorities(struct task_t* task, int size, enum rta_order_t order)
+{
+    if(order == RTA_TASK_PRIORITY)
+    {
+        return 0;
+    }
+
+    struct rta_rank_t* rank = rankTasks(task, size, order);
+
+    if(rank == NULL)
+    {
+        return 1;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        task[rank[i].index].priority = i;
+    }
+
+    free(rank);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Fixed-point response time of each task,
+///         highest priority first
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] order Order to rank the tasks in
+/// @param[out] response Response times, or NULL
+/// @param[out] result The outcome
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int response_time_analysis(struct task_t* task, int size, enum rta_order_t order, long long* response,
+                           struct rta_result_t* result)
+{
+    result->schedulable = 1;
+    result->first_miss = -1;
+    result->utilization = 0;
+    result->iterations = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        if((task[i].execution_time < 0) || (task[i].period < 0) || (task[i].deadline < 0) ||
+           ((task[i].period == 0) && (task[i].deadline == 0)))
+        {
+            fprintf(stderr, "%s() ERROR: Invalid task %d!\n", __func__, task[i].process_id);
+            return 1;
+        }
+
+        result->utilization += (task[i].period > 0) ? ((double)task[i].execution_time / task[i].period) : 0;
+
+        if(response != NULL)
+        {
+            response[i] = -1;
+        }
+    }
+
+    // NOTE: Demand grows faster than time, so some
+    //       task can't meet its deadline
+    if((response == NULL) && (result->utilization > 1))
+    {
+        result->schedulable = 0;
+        return 0;
+    }
+
+    struct rta_rank_t* rank = rankTasks(task, size, order);
+
+    if(rank == NULL)
+    {
+        return 1;
+    }
+
+    long long previous = -1;
+
+    for(int k = 0; k < size; k++)
+    {
+        struct task_t* current = &(task[rank[k].index]);
+        long long limit = limitOf(current);
+        int end = k + 1;
+
+        // Tasks of the same priority delay each other
+        while((end < size) && (rank[end].key == rank[k].key))
+        {
+            end++;
+        }
+
+        // NOTE: The task ranked just above is one of the
+        //       higher priority tasks here, and so is
+        //       every task which delayed it, so no fixed
+        //       point lies below its response time plus
+        //       this task's execution time
+        long long time = current->execution_time;
+
+        if((k > 0) && (previous >= 0) && (rank[k - 1].key < rank[k].key))
+        {
+            time += previous;
+        }
+        else
+        {
+            for(int j = 0; j < end; j++)
+            {
+                time += (j != k) ? task[rank[j].index].execution_time : 0;
+            }
+        }
+
+        while(time <= limit)
+        {
+            long long demand = current->execution_time;
+
+            for(int j = 0; j < end; j++)
+            {
+                struct task_t* other = &(task[rank[j].index]);
+
+                if(j == k)
+                {
+                    continue;
+                }
+
+                // A task released once delays this one once
+                demand += (other->period > 0) ? (((time + other->period - 1) / other->period) * other->execution_time)
+                                              : other->execution_time;
+            }
+
+            result->iterations++;
+
+            if(demand == time)
+            {
+                break;
+            }
+
+            time = demand;
+        }
+
+        if(time > limit)
+        {
+            result->schedulable = 0;
+            result->first_miss = (result->first_miss < 0) ? rank[k].index : result->first_miss;
+            previous = -1;
+
+            if(response == NULL)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        previous = time;
+
+        if(response != NULL)
+        {
+            response[rank[k].index] = time;
+        }
+    }
+
+    free(rank);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Sort the tasks by priority
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] order Order to rank the tasks in
+///
+/// @return The ranking; NULL: Allocation failed
+///-------------------------------------------------
+static struct rta_rank_t* rankTasks(struct task_t* task, int size, enum rta_order_t order)
+{
+    // NOTE: One spare entry keeps an empty task set
+    //       from asking malloc for 0 bytes
+    struct rta_rank_t* rank = (struct rta_rank_t*)malloc(((size_t)size + 1) * sizeof(struct rta_rank_t));
+
+    if(rank == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create ranking!\n", __func__);
+        return NULL;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        long long key = task[i].priority;
+
+        if(order == RTA_RATE_MONOTONIC)
+        {
+            // A task released once ranks by its deadline
+            key = (task[i].period > 0) ? task[i].period : task[i].deadline;
+        }
+        else if(order == RTA_DEADLINE_MONOTONIC)
+        {
+            key = limitOf(&(task[i]));
+        }
+
+        // Array order breaks ties, except between tasks
+        // sharing a priority field
+        rank[i].key = (order == RTA_TASK_PRIORITY) ? key : ((key * (long long)size) + i);
+        rank[i].index = i;
+    }
+
+    qsort(rank, (size_t)size, sizeof(struct rta_rank_t), compareRank);
+
+    return rank;
+}
+
+
+///-------------------------------------------------
+/// @brief  Latest response time a task can have
+///         for the analysis to hold
+///
+/// @param[in] task The task
+///
+/// @return The smaller of deadline and period
+///-------------------------------------------------
+static long long limitOf(struct task_t* task)
+{
+    if(task->period == 0)
+    {
+        return task->deadline;
+    }
+
+    return ((task->deadline > 0) && (task->deadline < task->period)) ? task->deadline : task->period;
+}
+
+
+///-------------------------------------------------
+/// @brief  qsort() comparison of two ranks, by key
+///         then by task
+///
+/// @param[in] left The first rank
+/// @param[in] right The second rank
+///
+/// @return <0, 0 or >0 as left ranks higher, equal
+///         or lower
+///-------------------------------------------------
+static int compareRank(const void* left, const void* right)
+{
+    const struct rta_rank_t* a = (const struct rta_rank_t*)left;
+    const struct rta_rank_t* b = (const struct rta_rank_t*)right;
+
+    if(a->key != b->key)
+    {
+        return (a->key > b->key) - (a->key < b->key);
+    }
+
+    return (a->index > b->index) - (a->index < b->index);
+}
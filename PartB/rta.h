@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __RESPONSE_TIME_ANALYSIS__
+#define __RESPONSE_TIME_ANALYSIS__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Orders in which the analysis ranks the priorities of the tasks
+//----------------------------------------------------------------------------------------------------------------------------------
+enum rta_order_t {
+    // Shorter period first, then array order (rate monotonic)
+    RTA_RATE_MONOTONIC,
+
+    // Shorter deadline first, then array order (deadline monotonic)
+    RTA_DEADLINE_MONOTONIC,
+
+    // The priority field of each task; tasks of the same priority may delay each other
+    RTA_TASK_PRIORITY
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the outcome of a response time analysis
+//----------------------------------------------------------------------------------------------------------------------------------
+struct rta_result_t {
+
+    // True if every task completes each job by its deadline
+    int schedulable;
+
+    // Highest priority task which can miss its deadline, -1 if none
+    int first_miss;
+
+    // Sum over the periodic tasks of execution_time / period
+    double utilization;
+
+    // Number of fixed-point iterations computed, a measure of the cost of the analysis
+    long long iterations;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Set the priority field of each task to its rank in an order, 0 being the highest, so the
+/// schedulers (see priority.h and edf.h) run the tasks in the order the analysis assumed
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] order The order to rank the tasks in; RTA_TASK_PRIORITY leaves them as they are
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int rta_assign_priorities(struct task_t *task, int size, enum rta_order_t order);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Compute the worst case response time of each task of a fixed priority preemptive system
+///
+/// @note Task i is released with every higher priority task at once (the critical instant) and
+///       its response time is the least R = C_i + sum over higher priority tasks j of
+///       ceil(R / T_j) * C_j, found by fixed-point iteration. The iteration of a task stops as
+///       soon as R exceeds min(deadline, period), since R only grows; this makes the analysis exact
+///       for deadlines up to the period and safe for longer ones. Every task after the first
+///       starts from the response time of the task ranked just above it plus its own execution
+///       time, which no fixed point is below, instead of from scratch. Without a response buffer
+///       the analysis stops at the first miss, and doesn't iterate at all if the utilization is
+///       above 1. arrival_time is ignored; a task released once (period 0) delays the tasks below
+///       it by one execution_time.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] order The order to rank the priorities of the tasks in
+/// @param[out] response The buffer receiving the worst case response time of each task, -1 for a
+///                      task which can miss its deadline; may be NULL
+/// @param[out] result The outcome of the analysis
+///
+/// @return 0 on success, 1 if a task is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int response_time_analysis(struct task_t *task, int size, enum rta_order_t order, long long *response,
+                           struct rta_result_t *result);
+
+#endif // __RESPONSE_TIME_ANALYSIS__
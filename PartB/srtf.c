@@ -0,0 +1,172 @@
+#include "srtf.h"
+#include "events.h"
+#include "taskheap.h"
+#include <limits.h>
+
+
+// Kind of the only event of the scheduler
+#define EVENT_ARRIVAL 0
+
+
+static int admitArrivals(struct event_queue_t* events, struct task_heap_t* ready, struct task_t* task, long long time);
+
+
+///-------------------------------------------------
+/// @brief  Shortest Remaining Time First scheduler
+///         which runs the current task up to the
+///         next arrival and decides again
+///
+/// @param[in] task The task queue array
+/// @param[in] size Size of the task queue array
+/// @param[in] trace Sink for the times, or NULL
+/// @param[out] stats Counters of the run, or NULL
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int shortest_remaining_time_first(struct task_t* task, int size, struct trace_sink_t* trace, struct rr_stats_t* stats)
+{
+    struct event_queue_t events;
+    struct task_heap_t ready;
+    struct task_t* running = NULL;
+    long long now = 0;
+    long long slices = 0;
+    long long switches = 0;
+    int lastTaskRan = INT_MAX;
+    struct run_metrics_t metrics;
+    int status = 0;
+
+    if(event_queue_init(&events, size))
+    {
+        return 1;
+    }
+
+    if(task_heap_init(&ready, size))
+    {
+        event_queue_free(&events);
+        return 1;
+    }
+
+    trace_begin(trace, &metrics);
+
+    for(int i = 0; i < size; i++)
+    {
+        event_push(&events, task[i].arrival_time, EVENT_ARRIVAL, i);
+    }
+
+    while(status == 0)
+    {
+        const struct event_t* next = event_peek(&events);
+
+        if(running == NULL)
+        {
+            if(!task_heap_is_empty(&ready))
+            {
+                running = task_heap_pop(&ready);
+            }
+            else if(next != NULL)
+            {
+                // Idle until the next arrival
+                now = next->time;
+                status = admitArrivals(&events, &ready, task, now);
+                continue;
+            }
+            else
+            {
+                break;
+            }
+
+            slices++;
+
+            if(lastTaskRan != running->process_id)
+            {
+                switches += (lastTaskRan != INT_MAX);
+            }
+
+            lastTaskRan = running->process_id;
+            continue;
+        }
+
+        long long finish = now + running->left_to_execute;
+
+        // NOTE: A task arriving as the running one ends
+        //       is ready before the next one is picked
+        if((next != NULL) && (next->time <= finish))
+        {
+            // "Execute" the running task up to the arrival
+            running->left_to_execute -= (int)(next->time - now);
+            now = next->time;
+            status = admitArrivals(&events, &ready, task, now);
+
+            // Preempt only for strictly less time left, so
+            // a tie keeps running
+            struct task_t* shortest = task_heap_peek(&ready);
+
+            if((status == 0) && (shortest->left_to_execute < running->left_to_execute))
+            {
+                status = task_heap_push(&ready, running);
+                running = NULL;
+            }
+
+            continue;
+        }
+
+        // "Execute" the running task to completion
+        now = finish;
+        running->left_to_execute = 0;
+        running->turnaround_time = (int)(now - running->arrival_time);
+        running->waiting_time = running->turnaround_time - running->execution_time;
+
+        run_metrics_add(&metrics, running->waiting_time, running->turnaround_time);
+        trace_event(trace, running->process_id, running->waiting_time, running->turnaround_time);
+        running = NULL;
+    }
+
+    if(status == 0)
+    {
+        trace_finish(trace, &metrics);
+    }
+
+    if(stats != NULL)
+    {
+        stats->slices = slices;
+        stats->skipped_slices = 0;
+        stats->switches = switches;
+        stats->allocations = 0;
+        stats->overhead = 0;
+    }
+
+    // Cleanup
+    task_heap_free(&ready);
+    event_queue_free(&events);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Move every task arriving at a time into
+///         the ready heap
+///
+/// @param[in] events The pending arrivals
+/// @param[in] ready The ready heap
+/// @param[in] task The task queue array
+/// @param[in] time Time of the arrivals
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int admitArrivals(struct event_queue_t* events, struct task_heap_t* ready, struct task_t* task, long long time)
+{
+    struct event_t event;
+
+    while(!event_queue_is_empty(events) && (event_peek(events)->time == time))
+    {
+        event_pop(events, &event);
+
+        if(task_heap_push(ready, &(task[event.index])))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __SHORTEST_REMAINING_TIME_FIRST__
+#define __SHORTEST_REMAINING_TIME_FIRST__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the preemptive shortest remaining time first algorithm and calculate the wait and turn
+/// around time for each task, emitting the times of each task to a trace sink when it ends
+///
+/// @note The ready task with the least time left runs until it finishes or a task arrives with
+///       strictly less time left than it; tasks with the same time left run in array order. The
+///       ready tasks are kept in a d-ary heap keyed on left_to_execute (see taskheap.h) and the
+///       arrivals in an event queue (see events.h), so each decision costs O(log n) and idle gaps
+///       cost nothing. Wait and turn around times are measured from the arrival time. This gives
+///       the smallest average wait time any schedule can.
+///
+/// @param[in] task The buffer containing task data
+/// @param[in] size The size of the buffer
+/// @param[in] trace Where to emit the times, NULL to emit nothing
+/// @param[out] stats Counters collected during the run, may be NULL; a slice is a stretch of time
+///                   a task runs without being preempted
+///
+/// @return 0 on success, 1 if memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int shortest_remaining_time_first(struct task_t *task, int size, struct trace_sink_t *trace, struct rr_stats_t *stats);
+
+#endif // __SHORTEST_REMAINING_TIME_FIRST__
@@ -0,0 +1,268 @@
+#include "sweep.h"
+#include "ring.h"
+#include <pthread.h>
+#include <unistd.h>
+
+
+///-------------------------------------------------
+/// @brief  Work shared by every thread of a sweep
+///-------------------------------------------------
+struct sweep_job_t {
+    // Workload every quantum is evaluated on
+    int* execution;
+    int size;
+
+    // Quanta to evaluate and the table to fill
+    const int* quanta;
+    int count;
+    struct sweep_result_t* result;
+
+    // Index of the next quantum to hand out
+    int next;
+};
+
+
+///-------------------------------------------------
+/// @brief  State private to one thread of a sweep
+///-------------------------------------------------
+struct sweep_worker_t {
+    // Thread running the worker
+    pthread_t thread;
+
+    // Shared work
+    struct sweep_job_t* job;
+
+    // Private copy of the tasks
+    struct task_t* task;
+
+    // Private ready queue, reused for each quantum
+    struct ring_t arena;
+};
+
+
+static void* runWorker(void* argument);
+static void evaluate(struct sweep_worker_t* worker, int index);
+static int onlineThreads(void);
+
+
+///-------------------------------------------------
+/// @brief  Evaluate each quantum on a pool of
+///         threads
+///
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] quanta Quanta to evaluate
+/// @param[in] count Number of quanta
+/// @param[in] threads Number of threads, or 0
+/// @param[out] result One row per quantum
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int round_robin_sweep(int* execution, int size, const int* quanta, int count, int threads, struct sweep_result_t* result)
+{
+    for(int i = 0; i < count; i++)
+    {
+        if(quanta[i] < 1)
+        {
+            fprintf(stderr, "%s() ERROR: Invalid quantum %d!\n", __func__, quanta[i]);
+            return 1;
+        }
+    }
+
+    if(count < 1)
+    {
+        return 0;
+    }
+
+    if(threads < 1)
+    {
+        threads = onlineThreads();
+    }
+
+    // NOTE: A thread needs at least one quantum to
+    //       be worth its task copy
+    if(threads > count)
+    {
+        threads = count;
+    }
+
+    struct sweep_job_t job = {execution, size, quanta, count, result, 0};
+    struct sweep_worker_t* worker = (struct sweep_worker_t*)calloc((size_t)threads, sizeof(struct sweep_worker_t));
+
+    if(worker == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create workers!\n", __func__);
+        return 1;
+    }
+
+    // The calling thread is worker 0; the rest are
+    // spawned, and quanta are handed out one at a
+    // time, so a failed spawn or task copy only
+    // leaves fewer threads to share them
+    int spawned = 1;
+
+    for(int i = 0; i < threads; i++)
+    {
+        worker[i].job = &job;
+    }
+
+    for(int i = 1; i < threads; i++)
+    {
+        if(pthread_create(&(worker[i].thread), NULL, runWorker, &(worker[i])) != 0)
+        {
+            break;
+        }
+
+        spawned++;
+    }
+
+    runWorker(&(worker[0]));
+
+    for(int i = 1; i < spawned; i++)
+    {
+        pthread_join(worker[i].thread, NULL);
+    }
+
+    free(worker);
+
+    // NOTE: Any worker which got going took quanta
+    //       until none were left
+    if(job.next < count)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't copy the tasks!\n", __func__);
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Evaluate an arithmetic range of quanta
+///
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] first Smallest quantum
+/// @param[in] last Largest quantum
+/// @param[in] step Distance between quanta
+/// @param[in] threads Number of threads, or 0
+/// @param[out] result One row per quantum
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int round_robin_sweep_range(int* execution, int size, int first, int last, int step, int threads, struct sweep_result_t* result)
+{
+    if((first < 1) || (last < first) || (step < 1))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid range!\n", __func__);
+        return 1;
+    }
+
+    int count = (last - first) / step + 1;
+    int* quanta = (int*)malloc((size_t)count * sizeof(int));
+
+    if(quanta == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create quanta!\n", __func__);
+        return 1;
+    }
+
+    for(int i = 0; i < count; i++)
+    {
+        quanta[i] = first + (i * step);
+    }
+
+    int status = round_robin_sweep(execution, size, quanta, count, threads, result);
+
+    free(quanta);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Take quanta off the job until none are
+///         left
+///
+/// @param[in] argument The worker
+///
+/// @return NULL
+///-------------------------------------------------
+static void* runWorker(void* argument)
+{
+    struct sweep_worker_t* worker = (struct sweep_worker_t*)argument;
+    struct sweep_job_t* job = worker->job;
+
+    // NOTE: One spare entry keeps an empty workload
+    //       from asking malloc for 0 bytes
+    worker->task = (struct task_t*)malloc(((size_t)job->size + 1) * sizeof(struct task_t));
+
+    if((worker->task == NULL) || ring_init(&(worker->arena), job->size))
+    {
+        free(worker->task);
+        return NULL;
+    }
+
+    int index;
+
+    while((index = __atomic_fetch_add(&(job->next), 1, __ATOMIC_RELAXED)) < job->count)
+    {
+        evaluate(worker, index);
+    }
+
+    ring_free(&(worker->arena));
+    free(worker->task);
+
+    return NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Schedule the worker's copy of the tasks
+///         with one quantum of the job
+///
+/// @param[in] worker The worker
+/// @param[in] index Entry of the quanta to run
+///-------------------------------------------------
+static void evaluate(struct sweep_worker_t* worker, int index)
+{
+    struct sweep_job_t* job = worker->job;
+    struct sweep_result_t* row = &(job->result[index]);
+    struct rr_config_t config = rr_default_config();
+    struct rr_stats_t stats;
+    long long totalWait = 0;
+    long long totalTurnaround = 0;
+
+    // The fastest exact simulator, in the worker's
+    // own ring
+    config.ready_queue = RR_READY_RING;
+    config.skip_rounds = 1;
+    config.arena = &(worker->arena);
+
+    init(worker->task, job->execution, job->size);
+    round_robin_with_config(worker->task, job->quanta[index], job->size, &config, &stats);
+
+    for(int i = 0; i < job->size; i++)
+    {
+        totalWait += worker->task[i].waiting_time;
+        totalTurnaround += worker->task[i].turnaround_time;
+    }
+
+    row->quantum = job->quanta[index];
+    row->average_wait_time = (job->size > 0) ? ((float)((double)totalWait / job->size)) : 0;
+    row->average_turn_around_time = (job->size > 0) ? ((float)((double)totalTurnaround / job->size)) : 0;
+    row->slices = stats.slices;
+}
+
+
+///-------------------------------------------------
+/// @brief  Number of CPUs available to the sweep
+///
+/// @return At least 1
+///-------------------------------------------------
+static int onlineThreads(void)
+{
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (online > 0) ? (int)online : 1;
+}
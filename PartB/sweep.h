@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __SWEEP__
+#define __SWEEP__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the outcome of one quantum of a sweep
+//----------------------------------------------------------------------------------------------------------------------------------
+struct sweep_result_t {
+
+    // Quantum the workload was scheduled with
+    int quantum;
+
+    // Average wait time of the tasks
+    float average_wait_time;
+
+    // Average turn around time of the tasks
+    float average_turn_around_time;
+
+    // Number of quantum slices executed
+    long long slices;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm over the same workload once per quantum, spreading the
+/// quanta over a pool of threads
+///
+/// @note Each thread schedules its own copy of the tasks in its own ready queue, which it reuses
+///       for every quantum it takes
+///
+/// @param[in] execution The execution time for each task
+/// @param[in] size The number of tasks
+/// @param[in] quanta The quanta to evaluate
+/// @param[in] count The number of quanta
+/// @param[in] threads The number of threads, 0 for one per online CPU
+/// @param[out] result The table receiving one row per quantum, in the order of quanta
+///
+/// @return 0 on success, 1 if a quantum is less than 1 or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_sweep(int *execution, int size, const int *quanta, int count, int threads, struct sweep_result_t *result);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Sweep the quanta first, first + step, ... up to and including last
+///
+/// @param[in] execution The execution time for each task
+/// @param[in] size The number of tasks
+/// @param[in] first The smallest quantum
+/// @param[in] last The largest quantum
+/// @param[in] step The distance between quanta
+/// @param[in] threads The number of threads, 0 for one per online CPU
+/// @param[out] result The table receiving ((last - first) / step + 1) rows, in increasing quantum
+///
+/// @return 0 on success, 1 if the range is empty or invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_sweep_range(int *execution, int size, int first, int last, int step, int threads, struct sweep_result_t *result);
+
+#endif // __SWEEP__
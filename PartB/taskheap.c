@@ -0,0 +1,201 @@
+#include "taskheap.h"
+
+
+#define TASK_HEAP_MIN_CAPACITY 16
+
+
+static int isShorter(const struct task_t* left, const struct task_t* right);
+
+
+///-------------------------------------------------
+/// @brief  Create an empty task heap
+///
+/// @param[out] heap The task heap
+/// @param[in] capacity Initial number of tasks
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int task_heap_init(struct task_heap_t* heap, int capacity)
+{
+    heap->capacity = (capacity > TASK_HEAP_MIN_CAPACITY) ? capacity : TASK_HEAP_MIN_CAPACITY;
+    heap->size = 0;
+    heap->task = (struct task_t**)malloc((size_t)heap->capacity * sizeof(struct task_t*));
+
+    if(heap->task == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create task heap!\n", __func__);
+        heap->capacity = 0;
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Push a task and sift it up to its place
+///         in the heap
+///
+/// @param[in] heap The task heap
+/// @param[in] task The task
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int task_heap_push(struct task_heap_t* heap, struct task_t* task)
+{
+    if(heap->size == heap->capacity)
+    {
+        int capacity = (heap->capacity > 0) ? (2 * heap->capacity) : TASK_HEAP_MIN_CAPACITY;
+        struct task_t** grown = (struct task_t**)realloc(heap->task, (size_t)capacity * sizeof(struct task_t*));
+
+        if(grown == NULL)
+        {
+            fprintf(stderr, "%s() ERROR: Couldn't grow task heap!\n", __func__);
+            return 1;
+        }
+
+        heap->task = grown;
+        heap->capacity = capacity;
+    }
+
+    int slot = heap->size++;
+
+    // Move parents down until the new task's slot
+    // is found
+    while(slot > 0)
+    {
+        int parent = (slot - 1) / TASK_HEAP_ARITY;
+
+        if(!isShorter(task, heap->task[parent]))
+        {
+            break;
+        }
+
+        heap->task[slot] = heap->task[parent];
+        slot = parent;
+    }
+
+    heap->task[slot] = task;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Get the top of the heap
+///
+/// @param[in] heap The task heap
+///
+/// @return The shortest task; NULL: Empty
+///-------------------------------------------------
+struct task_t* task_heap_peek(struct task_heap_t* heap)
+{
+    return (heap->size > 0) ? heap->task[0] : NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Pop the top of the heap and sift the
+///         last task down into the hole
+///
+/// @param[in] heap The task heap
+///
+/// @return The shortest task; NULL: Empty
+///-------------------------------------------------
+struct task_t* task_heap_pop(struct task_heap_t* heap)
+{
+    if(heap->size == 0)
+    {
+        return NULL;
+    }
+
+    struct task_t* top = heap->task[0];
+    struct task_t* last = heap->task[--heap->size];
+    int slot = 0;
+
+    for(;;)
+    {
+        int first = (TASK_HEAP_ARITY * slot) + 1;
+        int end = first + TASK_HEAP_ARITY;
+        int child = first;
+
+        if(first >= heap->size)
+        {
+            break;
+        }
+
+        if(end > heap->size)
+        {
+            end = heap->size;
+        }
+
+        // Pick the shortest child
+        for(int i = first + 1; i < end; i++)
+        {
+            if(isShorter(heap->task[i], heap->task[child]))
+            {
+                child = i;
+            }
+        }
+
+        if(!isShorter(heap->task[child], last))
+        {
+            break;
+        }
+
+        heap->task[slot] = heap->task[child];
+        slot = child;
+    }
+
+    heap->task[slot] = last;
+
+    return top;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check if the task heap is empty
+///
+/// @param[in] heap The task heap
+///
+/// @return True/False
+///-------------------------------------------------
+int task_heap_is_empty(struct task_heap_t* heap)
+{
+    return (heap->size == 0);
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the task heap
+///
+/// @param[in] heap The task heap
+///-------------------------------------------------
+void task_heap_free(struct task_heap_t* heap)
+{
+    free(heap->task);
+
+    heap->task = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Order two tasks by time left to execute,
+///         then by position in the task array
+///
+/// @param[in] left The first task
+/// @param[in] right The second task
+///
+/// @return True if left runs first
+///-------------------------------------------------
+static int isShorter(const struct task_t* left, const struct task_t* right)
+{
+    if(left->left_to_execute != right->left_to_execute)
+    {
+        return (left->left_to_execute < right->left_to_execute);
+    }
+
+    return (left < right);
+}
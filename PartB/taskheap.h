@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __TASK_HEAP__
+#define __TASK_HEAP__
+
+// Children of each heap entry; four keep the heap shallow and a node's children in one cache line
+#define TASK_HEAP_ARITY 4
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Min-heap of task pointers ordered by the time they have left to execute, then by position
+/// in the task array
+///
+/// @note The time a task has left mustn't change while it is in the heap
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_heap_t {
+
+    // d-ary heap; the children of entry i are entries (d * i) + 1 to (d * i) + d
+    struct task_t** task;
+
+    // Number of tasks in the heap
+    int size;
+
+    // Number of tasks the heap can hold before it has to grow
+    int capacity;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Create an empty task heap
+///
+/// @param[out] heap The task heap
+/// @param[in] capacity The number of tasks the heap holds before it has to grow
+///
+/// @return 0 on success, 1 if the heap couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_heap_init(struct task_heap_t *heap, int capacity);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Add a task in O(log n), doubling the capacity if the heap is full
+///
+/// @param[in] heap The task heap
+/// @param[in] task The task, which must stay in the same task array as the others in the heap
+///
+/// @return 0 on success, 1 if the heap couldn't grow
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_heap_push(struct task_heap_t *heap, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Get the shortest task without removing it
+///
+/// @param[in] heap The task heap
+///
+/// @return the shortest task, NULL if the heap is empty
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* task_heap_peek(struct task_heap_t *heap);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Remove the shortest task in O(log n)
+///
+/// @param[in] heap The task heap
+///
+/// @return the shortest task, NULL if the heap is empty
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_t* task_heap_pop(struct task_heap_t *heap);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Check if the task heap is empty
+///
+/// @param[in] heap The task heap
+///
+/// @return True/False
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_heap_is_empty(struct task_heap_t *heap);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the memory held by the task heap, but not the tasks
+///
+/// @param[in] heap The task heap
+//----------------------------------------------------------------------------------------------------------------------------------
+void task_heap_free(struct task_heap_t *heap);
+
+#endif // __TASK_HEAP__
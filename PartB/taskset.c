@@ -0,0 +1,334 @@
+#include "taskset.h"
+#include <limits.h>
+#include <string.h>
+
+
+#define TASK_SET_FIELDS 5
+#define MIN(x, y) (((x) < (y)) ? (x) : (y))
+
+
+static float averageOf(int* values, int size);
+static int* mappedColumn(const struct column_file_t* file, enum column_id_t id);
+
+
+///-------------------------------------------------
+/// @brief  Allocate every array of the task set
+///         in one block
+///
+/// @param[out] set The task set
+/// @param[in] size The number of tasks
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int task_set_create(struct task_set_t* set, int size)
+{
+    int entries = (size > 0) ? size : 0;
+
+    // NOTE: One spare entry keeps an empty set from
+    //       asking malloc for 0 bytes
+    int* storage = (int*)malloc(((size_t)TASK_SET_FIELDS * entries + 1) * sizeof(int));
+
+    if(storage == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create task set!\n", __func__);
+        set->size = 0;
+        set->storage = NULL;
+        return 1;
+    }
+
+    set->size = entries;
+    set->process_id = storage;
+    set->execution_time = storage + entries;
+    set->waiting_time = storage + (2 * entries);
+    set->turnaround_time = storage + (3 * entries);
+    set->left_to_execute = storage + (4 * entries);
+    set->storage = storage;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Free the block backing the task set
+///
+/// @param[in] set The task set
+///-------------------------------------------------
+void task_set_free(struct task_set_t* set)
+{
+    free(set->storage);
+
+    set->size = 0;
+    set->storage = NULL;
+}
+
+
+///-------------------------------------------------
+/// @brief  Borrow the columns of a workload and a
+///         results file for the task set
+///
+/// @param[out] set The task set
+/// @param[in] workload The mapped workload
+/// @param[in] results The mapped results
+///
+/// @return 1: Missing column or allocation failed;
+///         0: Success
+///-------------------------------------------------
+int task_set_map(struct task_set_t* set, const struct column_file_t* workload, struct column_file_t* results)
+{
+    int* processId = mappedColumn(workload, COLUMN_PROCESS_ID);
+    int* execution = mappedColumn(workload, COLUMN_EXECUTION_TIME);
+    int* waiting = results->writable ? mappedColumn(results, COLUMN_WAITING_TIME) : NULL;
+    int* turnaround = results->writable ? mappedColumn(results, COLUMN_TURNAROUND_TIME) : NULL;
+
+    set->size = 0;
+    set->storage = NULL;
+
+    if((execution == NULL) || (waiting == NULL) || (turnaround == NULL) ||
+       (workload->rows != results->rows) || (workload->rows > INT_MAX))
+    {
+        fprintf(stderr, "%s() ERROR: Files don't hold matching int32 columns!\n", __func__);
+        return 1;
+    }
+
+    // Arrays no file provides are owned by the set
+    // NOTE: Round robin consumes a copy of the
+    //       execution times
+    size_t entries = (size_t)workload->rows;
+    int owned = (processId == NULL) + 1;
+
+    int* storage = (int*)malloc((owned * entries + 1) * sizeof(int));
+
+    if(storage == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create task set!\n", __func__);
+        return 1;
+    }
+
+    set->size = (int)entries;
+    set->execution_time = execution;
+    set->waiting_time = waiting;
+    set->turnaround_time = turnaround;
+    set->left_to_execute = storage;
+    set->storage = storage;
+
+    if(processId == NULL)
+    {
+        processId = storage + entries;
+
+        for(int i = 0; i < set->size; i++)
+        {
+            processId[i] = i;
+        }
+    }
+
+    set->process_id = processId;
+    memcpy(set->left_to_execute, execution, entries * sizeof(int));
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Initialize the task set
+///
+/// @param[in] set The task set
+/// @param[in] execution Array containing the
+///                      execution times of each
+///                      task
+///-------------------------------------------------
+void task_set_init(struct task_set_t* set, int* execution)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        set->process_id[i] = i;
+        set->execution_time[i] = execution[i];
+        set->left_to_execute[i] = execution[i];
+        set->waiting_time[i] = 0;
+        set->turnaround_time[i] = 0;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Scatter a task array into the arrays of
+///         the task set
+///
+/// @param[in] set The task set
+/// @param[in] task The task array
+///-------------------------------------------------
+void task_set_from_tasks(struct task_set_t* set, struct task_t* task)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        set->process_id[i] = task[i].process_id;
+        set->execution_time[i] = task[i].execution_time;
+        set->waiting_time[i] = task[i].waiting_time;
+        set->turnaround_time[i] = task[i].turnaround_time;
+        set->left_to_execute[i] = task[i].left_to_execute;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Gather the arrays of the task set into
+///         a task array
+///
+/// @param[in] set The task set
+/// @param[out] task The task array
+///-------------------------------------------------
+void task_set_to_tasks(struct task_set_t* set, struct task_t* task)
+{
+    for(int i = 0; i < set->size; i++)
+    {
+        task[i].process_id = set->process_id[i];
+        task[i].execution_time = set->execution_time[i];
+        task[i].waiting_time = set->waiting_time[i];
+        task[i].turnaround_time = set->turnaround_time[i];
+        task[i].left_to_execute = set->left_to_execute[i];
+        task[i].arrival_time = 0;
+        task[i].priority = 0;
+        task[i].period = 0;
+        task[i].deadline = 0;
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Round Robin scheduler over the arrays
+///         of a task set
+///
+/// @param[in] set The task set
+/// @param[in] quantum Length of a time slice
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int task_set_round_robin(struct task_set_t* set, int quantum)
+{
+    int size = set->size;
+    int runTime = 0;
+    int lastTaskRan = INT_MAX;
+
+    // Ready queue of task indices
+    // NOTE: A task is never queued twice, so a ring of
+    //       one slot per task can't overflow
+    int* ready = (int*)malloc(((size_t)size + 1) * sizeof(int));
+
+    if(ready == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create ready queue!\n", __func__);
+        return 1;
+    }
+
+    for(int i = 0; i < size; i++)
+    {
+        ready[i] = i;
+    }
+
+    int head = 0;
+    int count = size;
+
+    // Execute the round robin algorithm
+    while(count > 0)
+    {
+        // "Execute" the first task
+        int current = ready[head];
+
+        head = (head + 1 == size) ? 0 : (head + 1);
+        count--;
+
+        int taskRuntime = MIN(set->left_to_execute[current], quantum);
+        set->left_to_execute[current] -= taskRuntime;
+
+        // Update runtime
+        runTime += taskRuntime;
+
+        // NOTE: If the same task runs twice in a row
+        //       don't update the wait-time
+        if(lastTaskRan != set->process_id[current])
+        {
+            set->waiting_time[current] = runTime - (set->execution_time[current] - set->left_to_execute[current]);
+        }
+
+        set->turnaround_time[current] = runTime;
+        lastTaskRan = set->process_id[current];
+
+        // Requeue the task if it isn't finished
+        if(set->left_to_execute[current] != 0)
+        {
+            int tail = head + count;
+
+            ready[(tail >= size) ? (tail - size) : tail] = current;
+            count++;
+        }
+    }
+
+    free(ready);
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Calculate the average wait time of
+///         the tasks in the set
+///
+/// @param[in] set The task set
+///
+/// @return Average wait time of all tasks
+///-------------------------------------------------
+float task_set_average_wait_time(struct task_set_t* set)
+{
+    return averageOf(set->waiting_time, set->size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Calculate the average turnaround time of
+///         the tasks in the set
+///
+/// @param[in] set The task set
+///
+/// @return Average turnaround time of all tasks
+///-------------------------------------------------
+float task_set_average_turn_around_time(struct task_set_t* set)
+{
+    return averageOf(set->turnaround_time, set->size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Average one contiguous array
+///
+/// @param[in] values The array
+/// @param[in] size Number of entries
+///
+/// @return The average of the entries
+///-------------------------------------------------
+static float averageOf(int* values, int size)
+{
+    long long totalTime = 0;
+
+    for(int i = 0; i < size; i++)
+    {
+        totalTime += values[i];
+    }
+
+    return (float)((double)totalTime / size);
+}
+
+
+///-------------------------------------------------
+/// @brief  Find an int32 column of a file
+///
+/// @param[in] file The column file
+/// @param[in] id The column to find
+///
+/// @return The column; NULL: Missing or int64
+///-------------------------------------------------
+static int* mappedColumn(const struct column_file_t* file, enum column_id_t id)
+{
+    int width = 0;
+    int* column = (int*)column_file_column(file, id, &width);
+
+    return (width == sizeof(int)) ? column : NULL;
+}
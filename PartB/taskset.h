@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+#include "columns.h"
+
+#ifndef __TASK_SET__
+#define __TASK_SET__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds a set of tasks as one contiguous array per task_t field
+///
+/// @note Entry i of every array describes the same task, so a pass which only needs one field
+///       (e.g. the wait times) streams through just that array
+//----------------------------------------------------------------------------------------------------------------------------------
+struct task_set_t {
+
+    // Number of tasks in the set
+    int size;
+
+    // Process number of each task
+    int* process_id;
+
+    // Amount of time each task takes to execute
+    int* execution_time;
+
+    // Amount of time each task spends waiting to be executed
+    int* waiting_time;
+
+    // Amount of time each task spends in the queue
+    int* turnaround_time;
+
+    // Amount of time left for each task until it is finished
+    int* left_to_execute;
+
+    // Single allocation backing every array the set owns, NULL if it owns none of them
+    void* storage;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Allocate the arrays of a task set
+///
+/// @param[out] set The task set
+/// @param[in] size The number of tasks
+///
+/// @return 0 on success, 1 if the arrays couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_set_create(struct task_set_t *set, int size);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Release the arrays of a task set
+///
+/// @param[in] set The task set
+//----------------------------------------------------------------------------------------------------------------------------------
+void task_set_free(struct task_set_t *set);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Point a task set at the columns of mapped files instead of copying them. The execution
+/// times (and process ids, if the workload has them) are read from the workload, and the wait and
+/// turnaround times are written straight into the results.
+///
+/// @note Borrowed columns must be int32; process ids missing from both files are numbered in
+///       file order and each task's time left is copied from its execution time, since round
+///       robin consumes it. Close the files only after task_set_free().
+///
+/// @param[out] set The task set
+/// @param[in] workload A column file holding COLUMN_EXECUTION_TIME
+/// @param[in] results A read-write column file of as many rows holding COLUMN_WAITING_TIME and
+///                    COLUMN_TURNAROUND_TIME
+///
+/// @return 0 on success, 1 if a column is missing or the remaining arrays couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_set_map(struct task_set_t *set, const struct column_file_t *workload, struct column_file_t *results);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Intialize the task set, the same way init() initializes a task array
+///
+/// @param[in] set The task set
+/// @param[in] execution The execution time for each task
+//----------------------------------------------------------------------------------------------------------------------------------
+void task_set_init(struct task_set_t *set, int *execution);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Copy a task array into a task set of the same size
+///
+/// @param[in] set The task set
+/// @param[in] task The buffer containing task data
+//----------------------------------------------------------------------------------------------------------------------------------
+void task_set_from_tasks(struct task_set_t *set, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Copy a task set into a task array of the same size
+///
+/// @param[in] set The task set
+/// @param[out] task The buffer receiving task data
+//----------------------------------------------------------------------------------------------------------------------------------
+void task_set_to_tasks(struct task_set_t *set, struct task_t *task);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Run the round robin algorithm on a task set and
+/// calculate the wait and turn around time for each task
+///
+/// @param[in] set The task set
+/// @param[in] quantum The time to allow for each task to
+///                     execute between iterations
+///
+/// @return 0 on success, 1 if the ready queue couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int task_set_round_robin(struct task_set_t *set, int quantum);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Calculates the average wait time of a task set.
+///
+/// @param[in] set The task set
+///
+/// @return The average wait time.
+//----------------------------------------------------------------------------------------------------------------------------------
+float task_set_average_wait_time(struct task_set_t *set);
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Calculates the average turn around time of a task set.
+///
+/// @param[in] set The task set
+///
+/// @return The average turn around time.
+//----------------------------------------------------------------------------------------------------------------------------------
+float task_set_average_turn_around_time(struct task_set_t *set);
+
+#endif // __TASK_SET__
@@ -0,0 +1,265 @@
+#include "trace.h"
+#include <string.h>
+
+
+#define TRACE_BUFFER_SIZE 65536
+
+// Room for the longest line trace_event() or trace_summary() can format
+#define TRACE_LINE_SIZE 256
+
+
+static char* reserve(struct trace_sink_t* sink, size_t bytes);
+
+
+///-------------------------------------------------
+/// @brief  Open a trace sink and allocate its
+///         buffer
+///
+/// @param[out] sink The sink
+/// @param[in] mode Format of the trace
+/// @param[in] stream Where to write the trace
+///
+/// @return 1: Couldn't open; 0: Success
+///-------------------------------------------------
+int trace_open(struct trace_sink_t* sink, enum trace_mode_t mode, FILE* stream)
+{
+    sink->mode = mode;
+    sink->stream = stream;
+    sink->buffer = NULL;
+    sink->capacity = 0;
+    sink->used = 0;
+    sink->events = 0;
+
+    run_metrics_init(&(sink->metrics));
+    sink->wait_histogram.bucket = NULL;
+    sink->turnaround_histogram.bucket = NULL;
+
+    if(mode == TRACE_NONE)
+    {
+        return 0;
+    }
+
+    if(stream == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: No stream to trace to!\n", __func__);
+        sink->mode = TRACE_NONE;
+        return 1;
+    }
+
+    sink->buffer = (char*)malloc(TRACE_BUFFER_SIZE);
+
+    // Verify that malloc didn't fail
+    if(sink->buffer == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create trace buffer!\n", __func__);
+        sink->mode = TRACE_NONE;
+        return 1;
+    }
+
+    sink->capacity = TRACE_BUFFER_SIZE;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Allocate the histograms of a sink
+///
+/// @param[in] sink The sink
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+int trace_keep_histograms(struct trace_sink_t* sink)
+{
+    if(sink->wait_histogram.bucket != NULL)
+    {
+        return 0;
+    }
+
+    if(histogram_init(&(sink->wait_histogram)) || histogram_init(&(sink->turnaround_histogram)))
+    {
+        histogram_free(&(sink->wait_histogram));
+        histogram_free(&(sink->turnaround_histogram));
+        return 1;
+    }
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Check if a sink records events
+///
+/// @param[in] sink The sink
+///
+/// @return True/False
+///-------------------------------------------------
+int trace_enabled(const struct trace_sink_t* sink)
+{
+    return ((sink != NULL) && (sink->mode != TRACE_NONE));
+}
+
+
+///-------------------------------------------------
+/// @brief  Buffer the times of the task which just
+///         ran
+///
+/// @param[in] sink The sink
+/// @param[in] process_id Process number
+/// @param[in] waiting_time Wait time
+/// @param[in] turnaround_time Turnaround time
+///-------------------------------------------------
+void trace_event(struct trace_sink_t* sink, int process_id, int waiting_time, int turnaround_time)
+{
+    if(!trace_enabled(sink))
+    {
+        return;
+    }
+
+    sink->events++;
+
+    if(sink->mode == TRACE_BINARY)
+    {
+        struct trace_event_t event;
+
+        event.process_id = process_id;
+        event.waiting_time = waiting_time;
+        event.turnaround_time = turnaround_time;
+
+        memcpy(reserve(sink, sizeof(event)), &event, sizeof(event));
+        sink->used += sizeof(event);
+        return;
+    }
+
+    sink->used += snprintf(reserve(sink, TRACE_LINE_SIZE), TRACE_LINE_SIZE,
+                           "\nTask[%d] Wait Time: %d\nTask[%d] Turnaround Time: %d\n",
+                           process_id, waiting_time, process_id, turnaround_time);
+}
+
+
+///-------------------------------------------------
+/// @brief  Buffer the averages of a finished run
+///
+/// @param[in] sink The sink
+/// @param[in] average_wait Average wait time
+/// @param[in] average_turnaround Average
+///                               turnaround time
+///-------------------------------------------------
+void trace_summary(struct trace_sink_t* sink, float average_wait, float average_turnaround)
+{
+    if(!trace_enabled(sink) || (sink->mode != TRACE_TEXT))
+    {
+        return;
+    }
+
+    sink->used += snprintf(reserve(sink, TRACE_LINE_SIZE), TRACE_LINE_SIZE,
+                           "Average Wait Time: %f\nAverage Turnaround Time: %f\n",
+                           average_wait, average_turnaround);
+}
+
+
+///-------------------------------------------------
+/// @brief  Empty the metrics of a run and have
+///         them feed the sink's histograms
+///
+/// @param[in] sink The sink
+/// @param[out] metrics Metrics of the run
+///-------------------------------------------------
+void trace_begin(struct trace_sink_t* sink, struct run_metrics_t* metrics)
+{
+    run_metrics_init(metrics);
+
+    // NOTE: The tasks are recorded straight into the
+    //       sink's histograms, so they needn't merge
+    if((sink != NULL) && (sink->wait_histogram.bucket != NULL))
+    {
+        metrics->wait_histogram = &(sink->wait_histogram);
+        metrics->turnaround_histogram = &(sink->turnaround_histogram);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Merge the times of a run into the sink
+///         and emit their averages
+///
+/// @param[in] sink The sink
+/// @param[in] metrics Times of the finished tasks
+///-------------------------------------------------
+void trace_finish(struct trace_sink_t* sink, const struct run_metrics_t* metrics)
+{
+    if(sink == NULL)
+    {
+        return;
+    }
+
+    run_metrics_merge(&(sink->metrics), metrics);
+
+    if(metrics->wait.count > 0)
+    {
+        trace_summary(sink, (float)metric_mean(&(metrics->wait)), (float)metric_mean(&(metrics->turnaround)));
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  Write the buffered events out
+///
+/// @param[in] sink The sink
+///-------------------------------------------------
+void trace_flush(struct trace_sink_t* sink)
+{
+    if(!trace_enabled(sink) || (sink->used == 0))
+    {
+        return;
+    }
+
+    fwrite(sink->buffer, 1, sink->used, sink->stream);
+    fflush(sink->stream);
+
+    sink->used = 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Flush the sink and free its buffer
+///
+/// @param[in] sink The sink
+///-------------------------------------------------
+void trace_close(struct trace_sink_t* sink)
+{
+    if(sink == NULL)
+    {
+        return;
+    }
+
+    trace_flush(sink);
+    free(sink->buffer);
+    histogram_free(&(sink->wait_histogram));
+    histogram_free(&(sink->turnaround_histogram));
+
+    sink->buffer = NULL;
+    sink->capacity = 0;
+    sink->mode = TRACE_NONE;
+}
+
+
+///-------------------------------------------------
+/// @brief  Make room at the end of the buffer,
+///         flushing it if it is too full
+///
+/// @param[in] sink The sink
+/// @param[in] bytes Number of bytes needed
+///
+/// @return Where to write the next bytes
+///-------------------------------------------------
+static char* reserve(struct trace_sink_t* sink, size_t bytes)
+{
+    if((sink->capacity - sink->used) < bytes)
+    {
+        fwrite(sink->buffer, 1, sink->used, sink->stream);
+        sink->used = 0;
+    }
+
+    return sink->buffer + sink->used;
+}
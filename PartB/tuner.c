@@ -0,0 +1,337 @@
+#include "tuner.h"
+#include "ring.h"
+#include <string.h>
+
+
+#define CANDIDATE_CAPACITY 64
+
+
+///-------------------------------------------------
+/// @brief  Growing list of quanta worth scheduling
+///-------------------------------------------------
+struct candidate_list_t {
+    // Quanta, sorted and unique after compaction
+    int* values;
+    int count;
+    int capacity;
+
+    // Range the quanta are clipped to
+    int first;
+    int last;
+};
+
+
+///-------------------------------------------------
+/// @brief  Scratch space reused by every
+///         evaluation
+///-------------------------------------------------
+struct tune_scratch_t {
+    // Copy of the tasks to schedule
+    struct task_t* task;
+
+    // Ready queue of the scheduler
+    struct ring_t arena;
+
+    // Wait times to rank (TUNE_P99_WAIT)
+    int* wait;
+};
+
+
+static int collectCandidates(struct candidate_list_t* list, int* execution, int size);
+static int addCandidate(struct candidate_list_t* list, int quantum);
+static void compactCandidates(struct candidate_list_t* list);
+static double evaluate(struct tune_scratch_t* scratch, int* execution, int size, int quantum, enum tune_objective_t objective, double switchCost);
+static int compareInt(const void* left, const void* right);
+
+
+///-------------------------------------------------
+/// @brief  Find the quantum minimizing an objective
+///         by scheduling only the quanta where the
+///         schedule changes shape
+///
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] min_quantum Smallest quantum
+/// @param[in] max_quantum Largest quantum, or 0
+/// @param[in] objective Quantity to minimize
+/// @param[in] switch_cost Cost of a context switch
+/// @param[out] result The best quantum
+///
+/// @return 1: Failure; 0: Success
+///-------------------------------------------------
+int round_robin_tune(int* execution, int size, int min_quantum, int max_quantum, enum tune_objective_t objective,
+                     double switch_cost, struct tune_result_t* result)
+{
+    if((min_quantum < 1) || (max_quantum < 0) || ((max_quantum != 0) && (max_quantum < min_quantum)))
+    {
+        fprintf(stderr, "%s() ERROR: Invalid quantum range!\n", __func__);
+        return 1;
+    }
+
+    int longest = 1;
+
+    for(int i = 0; i < size; i++)
+    {
+        if(execution[i] > longest)
+        {
+            longest = execution[i];
+        }
+    }
+
+    // Every quantum from the longest burst up gives
+    // the same schedule
+    int last = ((max_quantum == 0) || (max_quantum > longest)) ? longest : max_quantum;
+
+    if(last < min_quantum)
+    {
+        last = min_quantum;
+    }
+
+    struct candidate_list_t list = {NULL, 0, 0, min_quantum, last};
+    struct tune_scratch_t scratch;
+
+    // NOTE: One spare entry keeps an empty workload
+    //       from asking malloc for 0 bytes
+    scratch.task = (struct task_t*)malloc(((size_t)size + 1) * sizeof(struct task_t));
+    scratch.wait = (int*)malloc(((size_t)size + 1) * sizeof(int));
+
+    if((scratch.task == NULL) || (scratch.wait == NULL) || ring_init(&(scratch.arena), size))
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create scratch space!\n", __func__);
+        free(scratch.task);
+        free(scratch.wait);
+        return 1;
+    }
+
+    int status = collectCandidates(&list, execution, size);
+
+    result->quantum = min_quantum;
+    result->cost = 0;
+    result->evaluations = 0;
+
+    for(int i = 0; (status == 0) && (i < list.count); i++)
+    {
+        double cost = evaluate(&scratch, execution, size, list.values[i], objective, switch_cost);
+
+        // NOTE: Candidates are in increasing order, so a
+        //       tie keeps the smaller quantum
+        if((result->evaluations == 0) || (cost < result->cost))
+        {
+            result->quantum = list.values[i];
+            result->cost = cost;
+        }
+
+        result->evaluations++;
+    }
+
+    ring_free(&(scratch.arena));
+    free(scratch.task);
+    free(scratch.wait);
+    free(list.values);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  List both ends of every range of quanta
+///         over which no task changes its number
+///         of slices
+///
+/// @param[in] list The candidate list
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int collectCandidates(struct candidate_list_t* list, int* execution, int size)
+{
+    int* burst = (int*)malloc(((size_t)size + 1) * sizeof(int));
+
+    if(burst == NULL)
+    {
+        fprintf(stderr, "%s() ERROR: Couldn't create bursts!\n", __func__);
+        return 1;
+    }
+
+    memcpy(burst, execution, (size_t)size * sizeof(int));
+    qsort(burst, (size_t)size, sizeof(int), compareInt);
+
+    int status = addCandidate(list, list->first) || addCandidate(list, list->last);
+
+    for(int i = 0; (status == 0) && (i < size); i++)
+    {
+        int time = burst[i];
+
+        // Equal bursts change their slice count at the
+        // same quanta
+        if((i > 0) && (time == burst[i - 1]))
+        {
+            continue;
+        }
+
+        // Walk the blocks of quanta sharing a slice count
+        // ceil(time / quantum); each block starts where
+        // the previous one ends
+        for(int quantum = 1; (status == 0) && (quantum <= time) && (quantum <= list->last); )
+        {
+            int slices = (time + quantum - 1) / quantum;
+            int blockEnd = (slices == 1) ? time : ((time - 1) / (slices - 1));
+
+            status = addCandidate(list, quantum) || addCandidate(list, quantum - 1);
+            quantum = blockEnd + 1;
+        }
+    }
+
+    free(burst);
+    compactCandidates(list);
+
+    return status;
+}
+
+
+///-------------------------------------------------
+/// @brief  Add a quantum to the candidates if it
+///         is in range
+///
+/// @param[in] list The candidate list
+/// @param[in] quantum The quantum
+///
+/// @return 1: Allocation failed; 0: Success
+///-------------------------------------------------
+static int addCandidate(struct candidate_list_t* list, int quantum)
+{
+    if((quantum < list->first) || (quantum > list->last))
+    {
+        return 0;
+    }
+
+    if(list->count == list->capacity)
+    {
+        // Drop duplicates first, and only grow if that
+        // didn't free up half of the list
+        compactCandidates(list);
+
+        if(list->count >= (list->capacity / 2))
+        {
+            int capacity = (list->capacity > 0) ? (2 * list->capacity) : CANDIDATE_CAPACITY;
+            int* values = (int*)realloc(list->values, (size_t)capacity * sizeof(int));
+
+            if(values == NULL)
+            {
+                fprintf(stderr, "%s() ERROR: Couldn't grow candidates!\n", __func__);
+                return 1;
+            }
+
+            list->values = values;
+            list->capacity = capacity;
+        }
+    }
+
+    list->values[list->count++] = quantum;
+
+    return 0;
+}
+
+
+///-------------------------------------------------
+/// @brief  Sort the candidates and drop duplicates
+///
+/// @param[in] list The candidate list
+///-------------------------------------------------
+static void compactCandidates(struct candidate_list_t* list)
+{
+    int unique = 0;
+
+    if(list->count < 2)
+    {
+        return;
+    }
+
+    qsort(list->values, (size_t)list->count, sizeof(int), compareInt);
+
+    for(int i = 0; i < list->count; i++)
+    {
+        if((unique == 0) || (list->values[i] != list->values[unique - 1]))
+        {
+            list->values[unique++] = list->values[i];
+        }
+    }
+
+    list->count = unique;
+}
+
+
+///-------------------------------------------------
+/// @brief  Schedule the workload with one quantum
+///         and measure the objective
+///
+/// @param[in] scratch Scratch space
+/// @param[in] execution Execution times
+/// @param[in] size Number of tasks
+/// @param[in] quantum Length of a time slice
+/// @param[in] objective Quantity to measure
+/// @param[in] switchCost Cost of a context switch
+///
+/// @return The value of the objective
+///-------------------------------------------------
+static double evaluate(struct tune_scratch_t* scratch, int* execution, int size, int quantum, enum tune_objective_t objective, double switchCost)
+{
+    struct rr_config_t config = rr_default_config();
+    struct rr_stats_t stats;
+
+    if(size < 1)
+    {
+        return 0;
+    }
+
+    config.ready_queue = RR_READY_RING;
+    config.skip_rounds = 1;
+    config.arena = &(scratch->arena);
+
+    init(scratch->task, execution, size);
+    round_robin_with_config(scratch->task, quantum, size, &config, &stats);
+
+    switch(objective)
+    {
+        case TUNE_AVERAGE_WAIT:
+            return calculate_average_wait_time(scratch->task, size);
+
+        case TUNE_AVERAGE_TURNAROUND:
+            return calculate_average_turn_around_time(scratch->task, size);
+
+        case TUNE_P99_WAIT:
+            for(int i = 0; i < size; i++)
+            {
+                scratch->wait[i] = scratch->task[i].waiting_time;
+            }
+
+            qsort(scratch->wait, (size_t)size, sizeof(int), compareInt);
+
+            // Nearest rank: the smallest wait which at
+            // least 99% of the tasks don't exceed
+            return scratch->wait[((99LL * size) + 99) / 100 - 1];
+
+        case TUNE_TURNAROUND_WITH_SWITCHES:
+        default:
+            return calculate_average_turn_around_time(scratch->task, size) + (switchCost * stats.switches);
+    }
+}
+
+
+///-------------------------------------------------
+/// @brief  qsort() comparison of two ints
+///
+/// @param[in] left The first int
+/// @param[in] right The second int
+///
+/// @return <0, 0 or >0 as left is smaller, equal
+///         or larger
+///-------------------------------------------------
+static int compareInt(const void* left, const void* right)
+{
+    int a = *(const int*)left;
+    int b = *(const int*)right;
+
+    return (a > b) - (a < b);
+}
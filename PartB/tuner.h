@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rr.h"
+
+#ifndef __TUNER__
+#define __TUNER__
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Quantities the quantum tuner can minimize
+//----------------------------------------------------------------------------------------------------------------------------------
+enum tune_objective_t {
+    // Average wait time
+    TUNE_AVERAGE_WAIT,
+
+    // Average turn around time
+    TUNE_AVERAGE_TURNAROUND,
+
+    // 99th percentile (nearest rank) of the wait times
+    TUNE_P99_WAIT,
+
+    // Average turn around time plus switch_cost for every context switch
+    TUNE_TURNAROUND_WITH_SWITCHES
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Structure which holds the quantum the tuner picked
+//----------------------------------------------------------------------------------------------------------------------------------
+struct tune_result_t {
+
+    // Quantum with the lowest cost, the smallest one on a tie
+    int quantum;
+
+    // Value of the objective at that quantum
+    double cost;
+
+    // Number of quanta the workload was actually scheduled with
+    int evaluations;
+};
+
+//----------------------------------------------------------------------------------------------------------------------------------
+/// @brief Search for the quantum which minimizes an objective of the round robin algorithm
+///
+/// @note The number of slices each task needs only changes at a quantum where ceil(burst / quantum)
+///       changes for some distinct burst. Between two such quanta the order of the slices is fixed,
+///       and every slice before a task's completion is either a full quantum or the fixed last
+///       slice of another task, so every wait and turn around time is nondecreasing in the
+///       quantum while the number of switches stays the same. Each objective, the p99 wait time
+///       included, is then nondecreasing too and smallest at the lower end; only the ends are
+///       scheduled. An objective with a term which decreases in the quantum would need more.
+///
+/// @param[in] execution The execution time for each task
+/// @param[in] size The number of tasks
+/// @param[in] min_quantum The smallest quantum to consider
+/// @param[in] max_quantum The largest quantum to consider, 0 for the longest burst (every larger
+///                        quantum schedules like first come first served)
+/// @param[in] objective The quantity to minimize
+/// @param[in] switch_cost The cost of one context switch (TUNE_TURNAROUND_WITH_SWITCHES)
+/// @param[out] result The quantum found
+///
+/// @return 0 on success, 1 if the range is invalid or memory couldn't be allocated
+//----------------------------------------------------------------------------------------------------------------------------------
+int round_robin_tune(int *execution, int size, int min_quantum, int max_quantum, enum tune_objective_t objective,
+                     double switch_cost, struct tune_result_t *result);
+
+#endif // __TUNER__